@@ -0,0 +1,139 @@
+#include "benchmark/benchmark_api.h"
+
+#include "netlist/plib/ptime.h"
+#include "netlist/plib/ptimed_queue.h"
+
+#include <cstdint>
+#include <vector>
+
+// Compares the netlist event queue implementations on a synthetic event
+// trace shaped like a TTL board: a 7.16 MHz master clock, gate delays of
+// 8-30 ns, nets rescheduled while still queued, and one far away entry
+// marking the end of each 1/48000 s time slice. The trace is generated
+// from a fixed seed rather than captured from a running netlist; real
+// TTL games keep far fewer entries queued (see nltool -s on pongf).
+
+namespace {
+
+using nl_time = plib::ptime<std::int64_t, 10'000'000'000LL>;
+
+struct nl_object { unsigned id; };
+
+using nl_entry = plib::pqentry_t<nl_time, nl_object *>;
+
+struct trace_op
+{
+	enum op_type { PUSH, REMOVE, POP };
+	op_type op;
+	unsigned id;
+	std::int64_t time;
+};
+
+constexpr unsigned NETS = 600;
+constexpr std::size_t EVENTS = 200000;
+
+// Generate the trace, with the linear queue deciding the pop order
+std::vector<trace_op> make_ttl_trace()
+{
+	static const std::int64_t gate_delay[] = { 80, 120, 150, 180, 220, 300 };
+	const unsigned stop = NETS;
+	const std::int64_t clock_period = 698;
+	const std::int64_t slice = 208333;
+
+	std::vector<nl_object> objs(NETS + 1);
+	for (unsigned i = 0; i <= NETS; i++)
+		objs[i].id = i;
+	std::vector<bool> queued(NETS + 1, false);
+	std::vector<trace_op> trace;
+	plib::timed_queue_linear<nl_entry, false> q(NETS + 2);
+	std::uint32_t rnd = 0x12345678;
+	auto random = [&rnd]() { rnd = rnd * 1664525 + 1013904223; return rnd >> 8; };
+
+	auto push = [&](unsigned id, std::int64_t t)
+	{
+		if (queued[id])
+		{
+			trace.push_back({ trace_op::REMOVE, id, 0 });
+			q.remove<false>(&objs[id]);
+		}
+		trace.push_back({ trace_op::PUSH, id, t });
+		q.emplace<false>(nl_time::from_raw(t), &objs[id]);
+		queued[id] = true;
+	};
+
+	push(0, clock_period);
+	push(stop, slice);
+	for (std::size_t events = 0; events < EVENTS; events++)
+	{
+		const std::int64_t now = q.top().exec_time().as_raw();
+		const unsigned id = q.top().object()->id;
+		trace.push_back({ trace_op::POP, id, now });
+		q.pop();
+		queued[id] = false;
+
+		if (id == stop)
+		{
+			push(stop, now + slice);
+			continue;
+		}
+		if (id == 0)
+			push(0, now + clock_period);
+		// on average one net changes per event
+		unsigned fanout = (id == 0) ? 2 : random() % 3;
+		while (fanout-- > 0)
+			push(1 + random() % (NETS - 1), now + gate_delay[random() % 6]);
+	}
+	return trace;
+}
+
+const std::vector<trace_op> &ttl_trace()
+{
+	static const std::vector<trace_op> trace(make_ttl_trace());
+	return trace;
+}
+
+template <typename Q>
+bool replay(Q &q, std::vector<nl_object> &objs, const std::vector<trace_op> &trace)
+{
+	bool ok = true;
+	q.clear();
+	for (const auto &op : trace)
+	{
+		switch (op.op)
+		{
+			case trace_op::PUSH:
+				q.template emplace<false>(nl_time::from_raw(op.time), &objs[op.id]);
+				break;
+			case trace_op::REMOVE:
+				q.template remove<false>(&objs[op.id]);
+				break;
+			case trace_op::POP:
+				ok = ok && (q.top().object() == &objs[op.id]);
+				q.pop();
+				break;
+		}
+	}
+	return ok;
+}
+
+template <typename Q>
+void BM_netlist_queue(benchmark::State& state)
+{
+	const auto &trace = ttl_trace();
+	std::vector<nl_object> objs(NETS + 1);
+	Q q(NETS + 2);
+
+	// The heap returns entries with equal time in a different order, so
+	// it runs a slightly different event sequence.
+	if (!replay(q, objs, trace))
+		state.SetLabel("pop order differs from timed_queue_linear");
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(replay(q, objs, trace));
+	state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_netlist_queue, plib::timed_queue_linear<nl_entry, false>);
+BENCHMARK_TEMPLATE(BM_netlist_queue, plib::timed_queue_heap<nl_entry, false>);
+BENCHMARK_TEMPLATE(BM_netlist_queue, plib::timed_queue_calendar<nl_entry, false>);
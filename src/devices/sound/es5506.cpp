@@ -1007,6 +1007,30 @@ inline void es550x_device::generate_irq(es550x_voice *voice, int v)
 }
 
 
+/**********************************************************************************************
+
+     collect_live_voices -- list the voices that need to run for this block
+
+***********************************************************************************************/
+
+int es550x_device::collect_live_voices(int *live)
+{
+	// a stopped voice with no envelope left to run and no IRQ pending only
+	// has its accumulator masked, and nothing during the block can restart
+	// it, so it is handled once here and kept out of the per-sample loop
+	int count = 0;
+	for (int v = 0; v <= m_active_voices; v++)
+	{
+		es550x_voice *voice = &m_voice[v];
+		if ((voice->control & CONTROL_STOPMASK) && !voice->ecount && !(voice->control & CONTROL_IRQ))
+			voice->accum &= m_address_acc_mask;
+		else
+			live[count++] = v;
+	}
+	return count;
+}
+
+
 /**********************************************************************************************
 
      generate_samples -- tell each voice to generate samples
@@ -1015,19 +1039,27 @@ inline void es550x_device::generate_irq(es550x_voice *voice, int v)
 
 void es5506_device::generate_samples(std::vector<write_stream_view> &outputs)
 {
+	if (!outputs[0].samples())
+		return;
+
+	// special case: if end == start, stop the voice
+	for (int v = 0; v <= m_active_voices; v++)
+		if (m_voice[v].start == m_voice[v].end)
+			m_voice[v].control |= CONTROL_STOP0;
+
+	int live[32];
+	const int live_count = collect_live_voices(live);
+
 	// loop while we still have samples to generate
 	for (int sampindex = 0; sampindex < outputs[0].samples(); sampindex++)
 	{
 		// loop over voices
 		s32 cursample[12] = { 0 };
-		for (int v = 0; v <= m_active_voices; v++)
+		for (int i = 0; i < live_count; i++)
 		{
+			const int v = live[i];
 			es550x_voice *voice = &m_voice[v];
 
-			// special case: if end == start, stop the voice
-			if (voice->start == voice->end)
-				voice->control |= CONTROL_STOP0;
-
 			const int voice_channel = get_ca(voice->control);
 			const int channel = voice_channel % m_channels;
 			const int l = channel << 1;
@@ -1049,13 +1081,20 @@ void es5506_device::generate_samples(std::vector<write_stream_view> &outputs)
 
 void es5505_device::generate_samples(std::vector<write_stream_view> &outputs)
 {
+	if (!outputs[0].samples())
+		return;
+
+	int live[32];
+	const int live_count = collect_live_voices(live);
+
 	// loop while we still have samples to generate
 	for (int sampindex = 0; sampindex < outputs[0].samples(); sampindex++)
 	{
 		// loop over voices
 		s32 cursample[12] = { 0 };
-		for (int v = 0; v <= m_active_voices; v++)
+		for (int i = 0; i < live_count; i++)
 		{
+			const int v = live[i];
 			es550x_voice *voice = &m_voice[v];
 
 // This special case does not appear to match the behaviour observed in the es5505 in
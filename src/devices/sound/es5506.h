@@ -113,6 +113,7 @@ protected:
 	virtual void check_for_end_reverse(es550x_voice *voice, u64 &accum) = 0;
 	void generate_ulaw(es550x_voice *voice, s32 *dest);
 	void generate_pcm(es550x_voice *voice, s32 *dest);
+	int collect_live_voices(int *live);
 	inline void generate_irq(es550x_voice *voice, int v);
 	virtual void generate_samples(std::vector<write_stream_view> &outputs) {};
 
@@ -1121,6 +1121,12 @@ static inline void advance_lfo(FM_OPN *OPN)
 	}
 }
 
+/* true when all four operators of a channel have finished their release phase */
+static inline bool eg_channel_off(const FM_SLOT *SLOT)
+{
+	return (SLOT[0].state | SLOT[1].state | SLOT[2].state | SLOT[3].state) == EG_OFF;
+}
+
 /* changed from static inline to static here to work around gcc 4.2.1 codegen bug */
 static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 {
@@ -1128,6 +1134,11 @@ static void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 	unsigned int swap_flag;
 	unsigned int i;
 
+	/* nothing moves while all operators are off: volume stays at MAX_ATT_INDEX,
+	    so vol_out can't drop below ENV_QUIET whatever TL is, and KEY ON
+	    only changes the state (the next EG step picks the channel up again) */
+	if (eg_channel_off(SLOT))
+		return;
 
 	i = 4; /* four operators per channel */
 	do
@@ -1361,6 +1372,14 @@ static inline void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 {
 	unsigned int eg_out;
 
+	/* silent channel fast path: every operator is keyed off and released and
+	    the feedback and MEM delay lines have drained, so this channel adds
+	    nothing to the outputs. Phase counters are left alone because the next
+	    KEY ON restarts them. */
+	if (eg_channel_off(CH->SLOT) && !(CH->op1_out[0] | CH->op1_out[1] | CH->mem_value)
+		&& !(CH->SLOT[0].key | CH->SLOT[1].key | CH->SLOT[2].key | CH->SLOT[3].key))
+		return;
+
 	uint32_t AM = OPN->LFO_AM >> CH->ams;
 
 
@@ -123,6 +123,63 @@ void k054539_device::sound_stream_update(sound_stream &stream, std::vector<read_
 		return;
 	}
 
+	// Register writes are not synchronised with the stream, so the
+	// voice parameters stay fixed for the whole update: decode them
+	// once here instead of for every sample.
+	struct voice_params {
+		int delta, fdelta, pdelta;
+		double lvol, rvol, rbvol;
+		int rdelta;
+	} params[8];
+
+	for(int ch=0; ch<8; ch++) {
+		unsigned char *base1 = regs + 0x20*ch;
+		unsigned char *base2 = regs + 0x200 + 0x2*ch;
+		voice_params &vp = params[ch];
+
+		vp.delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
+
+		int vol = base1[0x03];
+
+		int bval = vol + base1[0x04];
+		if (bval > 255)
+			bval = 255;
+
+		int pan = base1[0x05];
+		// DJ Main: 81-87 right, 88 middle, 89-8f left
+		if (pan >= 0x81 && pan <= 0x8f)
+			pan -= 0x81;
+		else if (pan >= 0x11 && pan <= 0x1f)
+			pan -= 0x11;
+		else
+			pan = 0x18 - 0x11;
+
+		double cur_gain = gain[ch];
+
+		vp.lvol = voltab[vol] * pantab[pan] * cur_gain;
+		if (vp.lvol > VOL_CAP)
+			vp.lvol = VOL_CAP;
+
+		vp.rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
+		if (vp.rvol > VOL_CAP)
+			vp.rvol = VOL_CAP;
+
+		vp.rbvol= voltab[bval] * cur_gain / 2;
+		if (vp.rbvol > VOL_CAP)
+			vp.rbvol = VOL_CAP;
+
+		vp.rdelta = (base1[6] | (base1[7] << 8)) >> 3;
+
+		if(base2[0] & 0x20) {
+			vp.delta = -vp.delta;
+			vp.fdelta = +0x10000;
+			vp.pdelta = -1;
+		} else {
+			vp.fdelta = -0x10000;
+			vp.pdelta = +1;
+		}
+	}
+
 	for(int sample = 0; sample != outputs[0].samples(); sample++) {
 		double lval, rval;
 		if(!(flags & DISABLE_REVERB))
@@ -136,53 +193,18 @@ void k054539_device::sound_stream_update(sound_stream &stream, std::vector<read_
 				unsigned char *base1 = regs + 0x20*ch;
 				unsigned char *base2 = regs + 0x200 + 0x2*ch;
 				channel *chan = channels + ch;
+				voice_params const &vp = params[ch];
 
-				int delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
-
-				int vol = base1[0x03];
-
-				int bval = vol + base1[0x04];
-				if (bval > 255)
-					bval = 255;
-
-				int pan = base1[0x05];
-				// DJ Main: 81-87 right, 88 middle, 89-8f left
-				if (pan >= 0x81 && pan <= 0x8f)
-					pan -= 0x81;
-				else if (pan >= 0x11 && pan <= 0x1f)
-					pan -= 0x11;
-				else
-					pan = 0x18 - 0x11;
-
-				double cur_gain = gain[ch];
-
-				double lvol = voltab[vol] * pantab[pan] * cur_gain;
-				if (lvol > VOL_CAP)
-					lvol = VOL_CAP;
-
-				double rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
-				if (rvol > VOL_CAP)
-					rvol = VOL_CAP;
-
-				double rbvol= voltab[bval] * cur_gain / 2;
-				if (rbvol > VOL_CAP)
-					rbvol = VOL_CAP;
-
-				int rdelta = (base1[6] | (base1[7] << 8)) >> 3;
-				rdelta = (rdelta + reverb_pos) & 0x3fff;
+				int delta = vp.delta;
+				int fdelta = vp.fdelta;
+				int pdelta = vp.pdelta;
+				double lvol = vp.lvol;
+				double rvol = vp.rvol;
+				double rbvol = vp.rbvol;
+				int rdelta = (vp.rdelta + reverb_pos) & 0x3fff;
 
 				int cur_pos = (base1[0x0c] | (base1[0x0d] << 8) | (base1[0x0e] << 16));
 
-				int fdelta, pdelta;
-				if(base2[0] & 0x20) {
-					delta = -delta;
-					fdelta = +0x10000;
-					pdelta = -1;
-				} else {
-					fdelta = -0x10000;
-					pdelta = +1;
-				}
-
 				int cur_pfrac, cur_val, cur_pval;
 				if(cur_pos != chan->pos) {
 					chan->pos = cur_pos;
@@ -345,6 +367,8 @@ void k054539_device::init_chip()
 
 void k054539_device::write(offs_t offset, u8 data)
 {
+	sound_log_write(offset, data);
+
 	if(0) {
 		int voice, reg;
 
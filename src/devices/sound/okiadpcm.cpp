@@ -45,34 +45,6 @@ void oki_adpcm_state::reset()
 }
 
 
-//-------------------------------------------------
-//  clock - decode single nibble and update
-//  ADPCM output
-//-------------------------------------------------
-
-int16_t oki_adpcm_state::clock(uint8_t nibble)
-{
-	// update the signal
-	m_signal += s_diff_lookup[m_step * 16 + (nibble & 15)];
-
-	// clamp to the maximum
-	if (m_signal > 2047)
-		m_signal = 2047;
-	else if (m_signal < -2048)
-		m_signal = -2048;
-
-	// adjust the step size and clamp
-	m_step += s_index_shift[nibble & 7];
-	if (m_step > 48)
-		m_step = 48;
-	else if (m_step < 0)
-		m_step = 0;
-
-	// return the signal
-	return m_signal;
-}
-
-
 //-------------------------------------------------
 //  save - save current ADPCM state to buffer
 //-------------------------------------------------
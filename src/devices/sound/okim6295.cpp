@@ -233,6 +233,8 @@ uint8_t okim6295_device::read()
 
 void okim6295_device::write(uint8_t command)
 {
+	sound_log_write(0, command);
+
 	// if a command is pending, process the second half
 	if (m_command != -1)
 	{
@@ -343,21 +345,28 @@ void okim6295_device::okim_voice::generate_adpcm(device_rom_interface &rom, writ
 	if (!m_playing)
 		return;
 
-	// loop while we still have samples to generate
-	for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
+	// clip the block to the end of the phrase up front so the loop needs no end test
+	int const samples = std::min<uint32_t>(buffer.samples(), m_count - m_sample);
+
+	// each ROM byte holds two samples, high nibble first; fetch it once per pair
+	uint8_t data = (m_sample & 1) ? rom.read_byte(m_base_offset + m_sample / 2) : 0;
+	for (int sampindex = 0; sampindex < samples; sampindex++, m_sample++)
 	{
-		// fetch the next sample byte
-		int nibble = rom.read_byte(m_base_offset + m_sample / 2) >> (((m_sample & 1) << 2) ^ 4);
+		int nibble;
+		if (!(m_sample & 1))
+		{
+			data = rom.read_byte(m_base_offset + m_sample / 2);
+			nibble = data >> 4;
+		}
+		else
+			nibble = data & 0x0f;
 
 		// output to the buffer, scaling by the volume
 		// signal in range -2048..2047
 		buffer.add_int(sampindex, m_adpcm.clock(nibble) * m_volume, 2048);
-
-		// next!
-		if (++m_sample >= m_count)
-		{
-			m_playing = false;
-			break;
-		}
 	}
+
+	// next!
+	if (m_sample >= m_count)
+		m_playing = false;
 }
@@ -143,6 +143,8 @@ qsound_device::qsound_device(machine_config const &mconfig, char const *tag, dev
 
 void qsound_device::qsound_w(offs_t offset, u8 data)
 {
+	sound_log_write(offset, data);
+
 	switch (offset)
 	{
 	case 0:
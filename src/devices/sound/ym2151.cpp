@@ -1733,6 +1733,8 @@ u8 ym2151_device::read(offs_t offset)
 
 void ym2151_device::write(offs_t offset, u8 data)
 {
+	sound_log_write(offset & 1, data);
+
 	if (offset & 1)
 	{
 		if (!m_reset_active)
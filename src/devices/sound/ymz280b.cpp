@@ -171,6 +171,10 @@ int ymz280b_device::generate_adpcm(struct YMZ280BVoice *voice, s16 *buffer, int
 	int step = voice->step;
 	int val;
 
+	/* each ROM byte holds two nibbles; only go to the ROM when the byte changes */
+	int data_address = -1;
+	u8 data = 0;
+
 	/* two cases: first cases is non-looping */
 	if (!voice->looping)
 	{
@@ -178,7 +182,12 @@ int ymz280b_device::generate_adpcm(struct YMZ280BVoice *voice, s16 *buffer, int
 		while (samples)
 		{
 			/* compute the new amplitude and update the current step */
-			val = read_byte(position / 2) >> ((~position & 1) << 2);
+			if ((position / 2) != data_address)
+			{
+				data_address = position / 2;
+				data = read_byte(data_address);
+			}
+			val = data >> ((~position & 1) << 2);
 			signal += (step * diff_lookup[val & 15]) / 8;
 
 			/* clamp to the maximum */
@@ -215,7 +224,12 @@ int ymz280b_device::generate_adpcm(struct YMZ280BVoice *voice, s16 *buffer, int
 		while (samples)
 		{
 			/* compute the new amplitude and update the current step */
-			val = read_byte(position / 2) >> ((~position & 1) << 2);
+			if ((position / 2) != data_address)
+			{
+				data_address = position / 2;
+				data = read_byte(data_address);
+			}
+			val = data >> ((~position & 1) << 2);
 			signal += (step * diff_lookup[val & 15]) / 8;
 
 			/* clamp to the maximum */
@@ -37,10 +37,16 @@
 
 #pragma once
 
+#include "emuopts.h"
 #include "screen.h"
 
-#include <climits>
+#include <algorithm>
 #include <atomic>
+#include <climits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 //**************************************************************************
@@ -65,6 +71,13 @@ public:
 	static constexpr uint8_t FLAG_INCLUDE_RIGHT_EDGE  = 0x02;
 	static constexpr uint8_t FLAG_NO_WORK_QUEUE       = 0x04;
 
+	// depth compare used by the owner, for coarse depth rejection
+	enum depth_compare : uint8_t
+	{
+		DEPTH_LESS_EQUAL,                       // pixels pass when z <= buffer (also covers z < buffer)
+		DEPTH_GREATER_EQUAL                     // pixels pass when z >= buffer (also covers z > buffer)
+	};
+
 	// each vertex has an X/Y coordinate and a set of parameters
 	struct vertex_t
 	{
@@ -90,6 +103,27 @@ public:
 	// delegate type for scanline callbacks
 	typedef delegate<void (int32_t, const extent_t &, const ObjectData &, int)> render_delegate;
 
+	// work distribution statistics
+	struct statistics
+	{
+		uint64_t units = 0;                     // work units generated
+		uint64_t items = 0;                     // OSD work items queued
+		uint64_t waits = 0;                     // calls to wait()
+		uint64_t wait_ticks = 0;                // osd_ticks spent inside wait()
+		uint64_t bins = 0;                      // non-empty bins dispatched (binned mode)
+		uint64_t steals = 0;                    // bins taken from another worker (binned mode)
+		uint64_t busy_ticks = 0;                // osd_ticks workers spent rendering bins (binned mode)
+		uint64_t depth_rejected = 0;            // pixels removed by coarse depth rejection
+	};
+
+	// per-callback counters, kept when -poly_stats is enabled
+	struct mode_statistics
+	{
+		uint64_t spans = 0;                     // non-empty extents rendered
+		uint64_t pixels = 0;                    // pixels covered by those extents
+		uint64_t ticks = 0;                     // osd_ticks spent in the callback, summed over threads
+	};
+
 	// construction/destruction
 	poly_manager(running_machine &machine, uint8_t flags = 0);
 	poly_manager(screen_device &screen, uint8_t flags = 0);
@@ -99,9 +133,18 @@ public:
 	running_machine &machine() const { return m_machine; }
 	screen_device &screen() const { assert(m_screen != nullptr); return *m_screen; }
 	uint32_t triangles_drawn() const { return m_triangles; }
+	bool tile_binned() const { return m_binned; }
+	bool pipelined() const { return m_pipelined; }
+	const statistics &stats() const { return m_stats; }
+	bool instrumented() const { return m_instrumented; }
+
+	// instrumentation
+	void set_statistics_name(const char *name) { m_stats_name = name; }
+	void set_mode_name(render_delegate callback, const char *name);
 
 	// synchronization
 	void wait(const char *debug_reason = "general");
+	void flush();
 
 	// object data allocators
 	ObjectData &object_data_alloc();
@@ -120,6 +163,11 @@ public:
 	template<int _NumVerts>
 	uint32_t render_polygon(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t *v);
 
+	// coarse depth rejection
+	void enable_coarse_depth(int width, int height, depth_compare compare, BaseType farval);
+	void clear_coarse_depth();
+	void set_coarse_depth(int param, bool write) { m_depth_param = m_depth_tiles.empty() ? -1 : param; m_depth_write = write; }
+
 	// public helpers
 	int zclip_if_less(int numverts, const vertex_t *v, vertex_t *outv, int paramcount, BaseType clipval);
 
@@ -137,12 +185,25 @@ private:
 	static constexpr int TOTAL_BUCKETS        = (512 / SCANLINES_PER_BUCKET);
 	static constexpr int UNITS_PER_POLY       = (100 / SCANLINES_PER_BUCKET);
 
+	// coarse depth is kept per scanline segment of this many pixels
+	static constexpr int DEPTH_TILE_SHIFT     = 5;
+
+	// callbacks tracked separately by the instrumentation; later ones share the last slot
+	static constexpr int MAX_MODES            = 32;
+
+	// one thread's row of per-callback counters, aligned so rows never share a cache line
+	struct alignas(CACHE_LINE_SIZE) mode_statistics_row
+	{
+		mode_statistics mode[MAX_MODES];
+	};
+
 	// polygon_info describes a single polygon, which includes the poly_params
 	struct polygon_info
 	{
 		poly_manager *      m_owner;                // pointer back to the poly manager
 		ObjectData *        m_object;               // object data pointer
 		render_delegate     m_callback;             // callback to handle a scanline's worth of work
+		uint8_t             m_mode;                 // index of the callback in the mode table
 	};
 
 	// internal unit of work
@@ -158,6 +219,14 @@ private:
 		extent_t            extent[SCANLINES_PER_BUCKET]; // array of scanline extents
 	};
 
+	// in binned mode, each worker owns a range of bins and steals from the others when done
+	struct bin_worker
+	{
+		poly_manager *      owner;                  // pointer back to the poly manager
+		int                 index;                  // index of this worker
+		std::atomic<uint32_t> range;                // remaining bins: front in the low 16 bits, back (exclusive) in the high
+	};
+
 	//-------------------------------------------------
 	//  global helpers for float base types
 	//-------------------------------------------------
@@ -248,11 +317,22 @@ private:
 		polygon.m_owner = this;
 		polygon.m_object = &object_data_last();
 		polygon.m_callback = callback;
+		polygon.m_mode = m_instrumented ? find_mode(callback) : 0;
 		return polygon;
 	}
 
 	static void *work_item_callback(void *param, int threadid);
+	static void *bin_work_callback(void *param, int threadid);
+	void queue_units(uint32_t startunit);
+	void dispatch_bins();
+	int bin_take(bin_worker &worker);
+	int bin_steal(bin_worker &worker);
+	void render_bin(int bin, int threadid);
 	void presave() { wait("pre-save"); }
+	void coarse_depth_span(int32_t scanline, int32_t &startx, int32_t &stopx, BaseType z, BaseType dzdx);
+	void render_unit(work_unit &unit, int count, int threadid);
+	uint8_t find_mode(const render_delegate &callback);
+	void publish_statistics();
 
 	// queue management
 	running_machine &   m_machine;
@@ -270,6 +350,42 @@ private:
 	// buckets
 	uint16_t              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
 
+	// tile binning
+	bool                  m_binned;                   // true if units are binned and rendered at wait() time
+	bool                  m_bins_pending;             // true if flush() has dispatched bins that may still be rendering
+	bool                  m_pipelined;                // true if the owner should overlap rendering with the next frame
+	uint16_t              m_bin_head[TOTAL_BUCKETS];  // first unit in each bin
+	uint32_t              m_bin_cost[TOTAL_BUCKETS];  // estimated pixels in each bin
+	uint8_t               m_bin_order[TOTAL_BUCKETS]; // non-empty bins, in worker order
+	int                   m_bin_threads;              // maximum number of bin workers
+	bin_worker            m_worker[TOTAL_BUCKETS];    // bin workers
+	std::atomic<uint64_t> m_steals;                   // steals by the bin workers
+	std::atomic<uint64_t> m_busy_ticks;               // rendering time of the bin workers
+	statistics            m_stats;                    // work distribution statistics
+
+	// coarse depth
+	std::vector<BaseType> m_depth_tiles;              // farthest depth that can remain in each segment
+	int                   m_depth_width;              // width of the depth buffer
+	int                   m_depth_height;             // height of the depth buffer
+	int                   m_depth_stride;             // segments per scanline
+	BaseType              m_depth_clear;              // depth of a cleared buffer, nearer is smaller
+	bool                  m_depth_greater;            // true if larger depths are nearer
+	int                   m_depth_param;              // parameter holding depth, or -1 if not testing
+	bool                  m_depth_write;              // true if every pixel that passes writes its depth
+
+	// instrumentation
+	bool                  m_instrumented;             // true if per-callback counters are kept
+	std::string           m_stats_name;               // prefix of the published outputs
+	std::vector<render_delegate> m_modes;             // callbacks seen so far
+	std::vector<std::string> m_mode_names;            // names of the callbacks, for the outputs
+	std::unique_ptr<mode_statistics_row[]> m_mode_stats; // per-thread counters, one row per thread
+	std::vector<mode_statistics> m_mode_published;    // totals at the last publication
+	statistics            m_published;                // work statistics at the last publication
+	uint64_t              m_published_prims;          // primitives queued at the last publication
+	uint64_t              m_published_pixels;         // pixels queued at the last publication
+	osd_ticks_t           m_published_time;           // time of the last publication
+	int64_t               m_published_frame;          // frame of the last publication
+
 	// statistics
 	uint32_t              m_tiles;                    // number of tiles queued
 	uint32_t              m_triangles;                // number of triangles queued
@@ -309,6 +425,25 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 	, m_object(machine, *this)
 	, m_unit(machine, *this)
 	, m_flags(flags)
+	, m_binned(false)
+	, m_bins_pending(false)
+	, m_pipelined(false)
+	, m_bin_threads(std::clamp<int>(std::thread::hardware_concurrency(), 1, TOTAL_BUCKETS))
+	, m_steals(0)
+	, m_busy_ticks(0)
+	, m_depth_width(0)
+	, m_depth_height(0)
+	, m_depth_stride(0)
+	, m_depth_clear(0)
+	, m_depth_greater(false)
+	, m_depth_param(-1)
+	, m_depth_write(false)
+	, m_instrumented(machine.options().poly_stats())
+	, m_stats_name("poly")
+	, m_published_prims(0)
+	, m_published_pixels(0)
+	, m_published_time(osd_ticks())
+	, m_published_frame(-1)
 	, m_tiles(0)
 	, m_triangles(0)
 	, m_quads(0)
@@ -325,6 +460,25 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
 
+	// tile binning needs worker threads
+	m_binned = (m_queue != nullptr) && machine.options().poly_tile_binning();
+	m_pipelined = (m_queue != nullptr) && machine.options().poly_pipeline();
+	memset(m_bin_head, 0xff, sizeof(m_bin_head));
+	memset(m_bin_cost, 0, sizeof(m_bin_cost));
+	for (int workernum = 0; workernum < TOTAL_BUCKETS; workernum++)
+	{
+		m_worker[workernum].owner = this;
+		m_worker[workernum].index = workernum;
+		m_worker[workernum].range = 0;
+	}
+
+	// per-thread counters are padded out to cache lines
+	if (m_instrumented)
+	{
+		m_mode_stats = std::make_unique<mode_statistics_row[]>(WORK_MAX_THREADS);
+		m_mode_published.resize(MAX_MODES);
+	}
+
 	// request a pre-save callback for synchronization
 	machine.save().register_presave(save_prepost_delegate(FUNC(poly_manager::presave), this));
 }
@@ -359,6 +513,9 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::~poly_manager()
 	printf("Units:       %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), m_unit.waits(), m_unit.itemsize(), m_unit.allocated() * m_unit.itemsize());
 	printf("Polygons:    %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_polygon.max(), m_polygon.allocated(), m_polygon.waits(), m_polygon.itemsize(), m_polygon.allocated() * m_polygon.itemsize());
 	printf("Object data: %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), m_object.waits(), m_object.itemsize(), m_object.allocated() * m_object.itemsize());
+	printf("Work:        %d units, %d items, %d waits (%.3f ms)\n", (uint32_t)m_stats.units, (uint32_t)m_stats.items, (uint32_t)m_stats.waits, double(m_stats.wait_ticks) * 1000.0 / double(osd_ticks_per_second()));
+	if (m_binned)
+		printf("Bins:        %d rendered, %d stolen, %.3f ms busy\n", (uint32_t)m_stats.bins, (uint32_t)m_steals, double(m_busy_ticks) * 1000.0 / double(osd_ticks_per_second()));
 }
 #endif
 
@@ -411,8 +568,7 @@ void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callbac
 		}
 
 		// iterate over extents
-		for (int curscan = 0; curscan < count; curscan++)
-			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+		polygon.m_owner->render_unit(unit, count, threadid);
 
 		// set our count to 0 and re-fetch the original count value
 		do
@@ -430,6 +586,219 @@ void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callbac
 }
 
 
+//-------------------------------------------------
+//  render_unit - run the callback over the first
+//  count extents of a unit
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_unit(work_unit &unit, int count, int threadid)
+{
+	polygon_info &polygon = *unit.polygon;
+	if (!m_instrumented)
+	{
+		for (int curscan = 0; curscan < count; curscan++)
+			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+		return;
+	}
+
+	// each thread only touches its own row of counters
+	osd_ticks_t const starttime = osd_ticks();
+	uint32_t spans = 0, pixels = 0;
+	for (int curscan = 0; curscan < count; curscan++)
+	{
+		extent_t const &extent = unit.extent[curscan];
+		polygon.m_callback(unit.scanline + curscan, extent, *polygon.m_object, threadid);
+		if (extent.stopx > extent.startx)
+		{
+			spans++;
+			pixels += extent.stopx - extent.startx;
+		}
+	}
+	mode_statistics &counters = m_mode_stats[threadid].mode[polygon.m_mode];
+	counters.spans += spans;
+	counters.pixels += pixels;
+	counters.ticks += osd_ticks() - starttime;
+}
+
+
+//-------------------------------------------------
+//  queue_units - hand the units from startunit
+//  on to the work queue, or add them to their
+//  bins in binned mode
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::queue_units(uint32_t startunit)
+{
+	uint32_t const endunit = m_unit.count();
+	m_stats.units += endunit - startunit;
+	if (m_queue == nullptr)
+		return;
+
+	if (!m_binned)
+	{
+		osd_work_item_queue_multiple(m_queue, work_item_callback, endunit - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		m_stats.items += endunit - startunit;
+		return;
+	}
+
+	// bins handed out by flush() are read by the workers, so let them finish
+	// before starting new ones
+	if (m_bins_pending)
+	{
+		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		memset(m_bin_head, 0xff, sizeof(m_bin_head));
+		memset(m_bin_cost, 0, sizeof(m_bin_cost));
+		m_bins_pending = false;
+	}
+
+	// nothing runs until wait() or flush(), so we can link each unit behind the
+	// previous one in its bin with a plain store; bins are the same scanline
+	// buckets the conflict tracking uses
+	for (uint32_t unitnum = startunit; unitnum < endunit; unitnum++)
+	{
+		work_unit &unit = m_unit[unitnum];
+		uint32_t const bin = ((uint32_t)unit.scanline / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		uint32_t const count = unit.count_next.load(std::memory_order_relaxed);
+		if (unit.previtem == 0xffff)
+			m_bin_head[bin] = unitnum;
+		else
+			m_unit[unit.previtem].count_next.fetch_or(unitnum << 16, std::memory_order_relaxed);
+
+		// estimate the cost from the span widths
+		uint32_t cost = count;
+		for (uint32_t extnum = 0; extnum < count; extnum++)
+			cost += std::max(unit.extent[extnum].stopx - unit.extent[extnum].startx, 0);
+		m_bin_cost[bin] += cost;
+	}
+}
+
+
+//-------------------------------------------------
+//  dispatch_bins - split the non-empty bins into
+//  contiguous ranges of similar cost and start a
+//  worker for each range
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::dispatch_bins()
+{
+	int bins = 0;
+	uint64_t totalcost = 0;
+	for (int bin = 0; bin < TOTAL_BUCKETS; bin++)
+		if (m_bin_head[bin] != 0xffff)
+		{
+			m_bin_order[bins++] = bin;
+			totalcost += m_bin_cost[bin];
+		}
+	if (bins == 0)
+		return;
+
+	// give each worker roughly the same share of the estimated cost
+	int const workers = std::min(bins, m_bin_threads);
+	int front = 0;
+	uint64_t cost = 0;
+	for (int workernum = 0; workernum < workers; workernum++)
+	{
+		uint64_t const target = totalcost * (workernum + 1) / workers;
+		int back = front;
+		while (back < bins && (back == front || cost + m_bin_cost[m_bin_order[back]] / 2 <= target) && bins - back > workers - workernum - 1)
+			cost += m_bin_cost[m_bin_order[back++]];
+		if (workernum == workers - 1)
+			while (back < bins)
+				cost += m_bin_cost[m_bin_order[back++]];
+		m_worker[workernum].range.store(front | (back << 16), std::memory_order_relaxed);
+		front = back;
+	}
+
+	osd_work_item_queue_multiple(m_queue, bin_work_callback, workers, &m_worker[0], sizeof(m_worker[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	m_stats.items += workers;
+	m_stats.bins += bins;
+}
+
+
+//-------------------------------------------------
+//  bin_take - take the next bin from the front
+//  of a worker's own range
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+int poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::bin_take(bin_worker &worker)
+{
+	uint32_t range = worker.range.load(std::memory_order_acquire);
+	while ((range & 0xffff) < (range >> 16))
+		if (worker.range.compare_exchange_weak(range, range + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+			return m_bin_order[range & 0xffff];
+	return -1;
+}
+
+
+//-------------------------------------------------
+//  bin_steal - take a bin from the back of
+//  another worker's range
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+int poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::bin_steal(bin_worker &worker)
+{
+	for (int offset = 1; offset < TOTAL_BUCKETS; offset++)
+	{
+		bin_worker &victim = m_worker[(worker.index + offset) % TOTAL_BUCKETS];
+		uint32_t range = victim.range.load(std::memory_order_acquire);
+		while ((range & 0xffff) < (range >> 16))
+			if (victim.range.compare_exchange_weak(range, range - 0x10000, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				m_steals.fetch_add(1, std::memory_order_relaxed);
+				return m_bin_order[(range >> 16) - 1];
+			}
+	}
+	return -1;
+}
+
+
+//-------------------------------------------------
+//  render_bin - render all units in a bin, in
+//  submission order
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_bin(int bin, int threadid)
+{
+	osd_ticks_t const starttime = osd_ticks();
+	uint32_t unitnum = m_bin_head[bin];
+	while (true)
+	{
+		work_unit &unit = m_unit[unitnum];
+		uint32_t const count_next = unit.count_next.load(std::memory_order_relaxed);
+		render_unit(unit, count_next & 0xffff, threadid);
+
+		// unit 0 always heads its bin, so a link of 0 marks the end of the chain
+		unitnum = count_next >> 16;
+		if (unitnum == 0)
+			break;
+	}
+	m_busy_ticks.fetch_add(osd_ticks() - starttime, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------
+//  bin_work_callback - render bins until there
+//  are none left to take or steal
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::bin_work_callback(void *param, int threadid)
+{
+	bin_worker &worker = *(bin_worker *)param;
+	poly_manager &owner = *worker.owner;
+	int bin;
+	while ((bin = owner.bin_take(worker)) >= 0 || (bin = owner.bin_steal(worker)) >= 0)
+		owner.render_bin(bin, threadid);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -442,10 +811,17 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 	// remember the start time if we're logging
 	if (POLY_LOG_WAITS)
 		time = get_profile_ticks();
+	osd_ticks_t const starttime = osd_ticks();
 
 	// wait for all pending work items to complete
 	if (m_queue != nullptr)
+	{
+		if (m_binned && !m_bins_pending)
+			dispatch_bins();
+		g_profiler.start(PROFILER_RASTER_WAIT);
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		g_profiler.stop();
+	}
 
 	// if we don't have a queue, just run the whole list now
 	else
@@ -460,10 +836,24 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 			machine().logerror("Poly:Waited %d cycles for %s\n", (int)time, debug_reason);
 	}
 
+	// update statistics
+	m_stats.waits++;
+	m_stats.wait_ticks += osd_ticks() - starttime;
+	m_stats.steals = m_steals.load(std::memory_order_relaxed);
+	m_stats.busy_ticks = m_busy_ticks.load(std::memory_order_relaxed);
+	if (m_instrumented)
+		publish_statistics();
+
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	if (m_binned)
+	{
+		memset(m_bin_head, 0xff, sizeof(m_bin_head));
+		memset(m_bin_cost, 0, sizeof(m_bin_cost));
+		m_bins_pending = false;
+	}
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -477,6 +867,127 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 }
 
 
+//-------------------------------------------------
+//  flush - start rendering everything queued so
+//  far without waiting for it to complete
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::flush()
+{
+	// units are already running unless they are being held in bins
+	if (!m_binned || m_bins_pending)
+		return;
+
+	dispatch_bins();
+	m_bins_pending = true;
+
+	// later units must start new bin chains rather than link to running ones
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+}
+
+
+//-------------------------------------------------
+//  set_mode_name - name a callback in the
+//  published statistics
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::set_mode_name(render_delegate callback, const char *name)
+{
+	if (m_instrumented)
+		m_mode_names[find_mode(callback)] = name;
+}
+
+
+//-------------------------------------------------
+//  find_mode - return the counter slot for a
+//  callback, adding it if it is new
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+uint8_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::find_mode(const render_delegate &callback)
+{
+	for (int mode = 0; mode < int(m_modes.size()); mode++)
+		if (m_modes[mode] == callback)
+			return mode;
+	if (m_modes.size() == MAX_MODES)
+		return MAX_MODES - 1;
+	m_modes.push_back(callback);
+	m_mode_names.push_back((m_modes.size() == MAX_MODES) ? "other" : string_format("mode%d", int(m_modes.size() - 1)));
+	return m_modes.size() - 1;
+}
+
+
+//-------------------------------------------------
+//  publish_statistics - once per frame, set
+//  outputs to the work done since the previous
+//  frame so that Lua scripts and output clients
+//  can read them
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::publish_statistics()
+{
+	// owners may wait several times per frame; wait() has synchronized with
+	// the workers, so their counters can be read here
+	screen_device *const screen = (m_screen != nullptr) ? m_screen : screen_device_iterator(m_machine.root_device()).first();
+	int64_t const frame = (screen != nullptr) ? screen->frame_number() : int64_t(m_stats.waits);
+	if (frame == m_published_frame)
+		return;
+	m_published_frame = frame;
+
+	output_manager &output = m_machine.output();
+	auto const publish = [this, &output] (const std::string &name, uint64_t value)
+	{
+		output.set_value((m_stats_name + '.' + name).c_str(), s32(std::min<uint64_t>(value, INT_MAX)));
+	};
+	uint64_t const ticks_per_us = std::max<uint64_t>(osd_ticks_per_second() / 1000000, 1);
+
+	// sum the threads for each callback
+	mode_statistics total;
+	for (int mode = 0; mode < int(m_modes.size()); mode++)
+	{
+		mode_statistics current;
+		for (int threadnum = 0; threadnum < WORK_MAX_THREADS; threadnum++)
+		{
+			mode_statistics const &counters = m_mode_stats[threadnum].mode[mode];
+			current.spans += counters.spans;
+			current.pixels += counters.pixels;
+			current.ticks += counters.ticks;
+		}
+		mode_statistics &last = m_mode_published[mode];
+		publish(m_mode_names[mode] + ".spans", current.spans - last.spans);
+		publish(m_mode_names[mode] + ".pixels", current.pixels - last.pixels);
+		publish(m_mode_names[mode] + ".us", (current.ticks - last.ticks) / ticks_per_us);
+		total.spans += current.spans - last.spans;
+		total.pixels += current.pixels - last.pixels;
+		total.ticks += current.ticks - last.ticks;
+		last = current;
+	}
+
+	// totals, and how busy the hardware threads were over the frame
+	osd_ticks_t const now = osd_ticks();
+	uint64_t const prims = uint64_t(m_triangles) + m_quads + m_tiles;
+	uint64_t const available = uint64_t(now - m_published_time) * std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+	publish("primitives", prims - m_published_prims);
+	publish("queued_pixels", m_pixels - m_published_pixels);
+	publish("spans", total.spans);
+	publish("pixels", total.pixels);
+	publish("depth_rejected", m_stats.depth_rejected - m_published.depth_rejected);
+	publish("units", m_stats.units - m_published.units);
+	publish("waits", m_stats.waits - m_published.waits);
+	publish("wait_us", (m_stats.wait_ticks - m_published.wait_ticks) / ticks_per_us);
+	publish("render_us", total.ticks / ticks_per_us);
+	publish("thread_use", (available != 0) ? (total.ticks * 100 / available) : 0);
+
+	m_published = m_stats;
+	m_published_prims = prims;
+	m_published_pixels = m_pixels;
+	m_published_time = now;
+}
+
+
 //-------------------------------------------------
 //  object_data_alloc - allocate a new ObjectData
 //-------------------------------------------------
@@ -490,6 +1001,101 @@ ObjectData &poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::object_data
 }
 
 
+//-------------------------------------------------
+//  enable_coarse_depth - track the farthest depth
+//  left in each span segment, so that spans the
+//  owner's depth test would reject in full are
+//  dropped before they are queued
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::enable_coarse_depth(int width, int height, depth_compare compare, BaseType farval)
+{
+	m_depth_width = width;
+	m_depth_height = height;
+	m_depth_stride = (width + (1 << DEPTH_TILE_SHIFT) - 1) >> DEPTH_TILE_SHIFT;
+	m_depth_greater = (compare == DEPTH_GREATER_EQUAL);
+	m_depth_clear = m_depth_greater ? -farval : farval;
+	m_depth_tiles.assign(m_depth_stride * height, m_depth_clear);
+}
+
+
+//-------------------------------------------------
+//  clear_coarse_depth - reset the coarse depth;
+//  call wherever the owner clears its depth
+//  buffer
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::clear_coarse_depth()
+{
+	std::fill(m_depth_tiles.begin(), m_depth_tiles.end(), m_depth_clear);
+}
+
+
+//-------------------------------------------------
+//  coarse_depth_span - trim the segments at either
+//  end of a span that lie behind everything drawn
+//  there so far, and lower the farthest depth of
+//  the segments it covers if it writes depth
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::coarse_depth_span(int32_t scanline, int32_t &startx, int32_t &stopx, BaseType z, BaseType dzdx)
+{
+	if (startx >= stopx || startx < 0 || scanline < 0 || scanline >= m_depth_height)
+		return;
+
+	// compare with nearer always smaller
+	if (m_depth_greater)
+	{
+		z = -z;
+		dzdx = -dzdx;
+	}
+
+	// depth is linear along the span, so each segment's extremes are at its ends
+	BaseType *const row = &m_depth_tiles[scanline * m_depth_stride];
+	int32_t const origin = startx;
+	int32_t const limit = stopx;
+	auto const seg_start = [origin] (int32_t tile) { return std::max(origin, tile << DEPTH_TILE_SHIFT); };
+	auto const seg_end = [limit] (int32_t tile) { return std::min(limit, (tile + 1) << DEPTH_TILE_SHIFT); };
+	auto const depth_at = [origin, z, dzdx] (int32_t x) { return z + BaseType(x - origin) * dzdx; };
+
+	// leave some slack for the owner stepping depth by accumulation
+	auto const occluded = [&] (int32_t tile)
+	{
+		BaseType const nearz = std::min(depth_at(seg_start(tile)), depth_at(seg_end(tile) - 1));
+		return nearz > row[tile] + poly_abs(row[tile]) * BaseType(1.0 / 4096.0);
+	};
+
+	// segments past the right side of the buffer are never trimmed
+	int32_t first = origin >> DEPTH_TILE_SHIFT;
+	int32_t last = (limit - 1) >> DEPTH_TILE_SHIFT;
+	int32_t const lasttile = std::min(last, m_depth_stride - 1);
+	while (first <= lasttile && occluded(first))
+		first++;
+	if (first > last)
+	{
+		m_stats.depth_rejected += limit - origin;
+		startx = stopx = 0;
+		return;
+	}
+	if (last == lasttile)
+		while (last > first && occluded(last))
+			last--;
+
+	startx = seg_start(first);
+	stopx = seg_end(last);
+	m_stats.depth_rejected += (startx - origin) + (limit - stopx);
+
+	// only segments covered from end to end are known to be overwritten
+	if (m_depth_write)
+		for (int32_t tile = first; tile <= std::min(last, lasttile); tile++)
+			if ((tile << DEPTH_TILE_SHIFT) >= startx && std::min((tile + 1) << DEPTH_TILE_SHIFT, m_depth_width) <= stopx)
+				row[tile] = std::min(row[tile], std::max(depth_at(seg_start(tile)), depth_at(seg_end(tile) - 1)));
+}
+
+
 //-------------------------------------------------
 //  render_tile - render a tile
 //-------------------------------------------------
@@ -611,8 +1217,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_tile(co
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -779,6 +1384,13 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 			if (istopx > cliprect.right())
 				istopx = cliprect.right() + 1;
 
+			// drop the parts of the span that are hidden
+			if (m_depth_param >= 0 && m_depth_param < paramcount && istartx < istopx)
+			{
+				BaseType const zstart = param_start[m_depth_param] + (BaseType(istartx) + BaseType(0.5)) * param_dpdx[m_depth_param] + fully * param_dpdy[m_depth_param];
+				coarse_depth_span(curscan + extnum, istartx, istopx, zstart, param_dpdx[m_depth_param]);
+			}
+
 			// set the extent and update the total pixel count
 			if (istartx >= istopx)
 				istartx = istopx = 0;
@@ -799,8 +1411,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_triangles++;
@@ -915,8 +1526,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -1103,6 +1713,16 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_polygon
 			if (istopx > cliprect.right())
 				istopx = cliprect.right() + 1;
 
+			// drop the parts of the span that are hidden
+			if (m_depth_param >= 0 && m_depth_param < paramcount && istartx < istopx)
+			{
+				int32_t const origstartx = istartx;
+				coarse_depth_span(curscan + extnum, istartx, istopx, extent.param[m_depth_param].start, extent.param[m_depth_param].dpdx);
+				if (istartx > origstartx)
+					for (int paramnum = 0; paramnum < paramcount; paramnum++)
+						extent.param[paramnum].start += (istartx - origstartx) * extent.param[paramnum].dpdx;
+			}
+
 			// set the extent and update the total pixel count
 			if (istartx >= istopx)
 				istartx = istopx = 0;
@@ -1114,8 +1734,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_polygon
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_quads++;
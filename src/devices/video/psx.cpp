@@ -11,6 +11,7 @@
 #include "cpu/psx/psx.h"
 #include "video/psx.h"
 
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -41,6 +42,7 @@ psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, co
 	: device_t(mconfig, type, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_write_queue(nullptr)
 	, m_vblank_handler(*this)
 {
 }
@@ -64,10 +66,28 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	if( machine().options().psxgpu_thread() )
+	{
+		m_write_queue = osd_work_queue_alloc( 0 );
+		machine().save().register_presave( save_prepost_delegate( FUNC( psxgpu_device::sync_writes ), this ) );
+		machine().save().register_preload( save_prepost_delegate( FUNC( psxgpu_device::wait_writes ), this ) );
+	}
+}
+
+void psxgpu_device::device_stop()
+{
+	if( m_write_queue != nullptr )
+	{
+		sync_writes();
+		osd_work_queue_free( m_write_queue );
+		m_write_queue = nullptr;
+	}
 }
 
 void psxgpu_device::device_reset()
 {
+	sync_writes();
 	gpu_reset();
 }
 
@@ -564,20 +584,6 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 	for( int n_level = 0; n_level < 0x10000; n_level++ )
 	{
-		p_n_redlevel[ n_level ] = ( n_level & ( MAX_LEVEL - 1 ) ) * MAX_SHADE;
-		p_n_greenlevel[ n_level ] = ( ( n_level >> 5 ) & ( MAX_LEVEL - 1 ) ) * MAX_SHADE;
-		p_n_bluelevel[ n_level ] = ( ( n_level >> 10 ) & ( MAX_LEVEL - 1 ) ) * MAX_SHADE;
-
-		/* 0.5 * background */
-		p_n_redb05[ n_level ] = ( ( n_level & ( MAX_LEVEL - 1 ) ) / 2 ) * MAX_LEVEL;
-		p_n_greenb05[ n_level ] = ( ( ( n_level >> 5 ) & ( MAX_LEVEL - 1 ) ) / 2 ) * MAX_LEVEL;
-		p_n_blueb05[ n_level ] = ( ( ( n_level >> 10 ) & ( MAX_LEVEL - 1 ) ) / 2 ) * MAX_LEVEL;
-
-		/* 1 * background */
-		p_n_redb1[ n_level ] = ( n_level & ( MAX_LEVEL - 1 ) ) * MAX_LEVEL;
-		p_n_greenb1[ n_level ] = ( ( n_level >> 5 ) & ( MAX_LEVEL - 1 ) ) * MAX_LEVEL;
-		p_n_blueb1[ n_level ] = ( ( n_level >> 10 ) & ( MAX_LEVEL - 1 ) ) * MAX_LEVEL;
-
 		/* 24bit color */
 		p_n_g0r0[ n_level ] = ( ( ( n_level >> 8 ) & 0xff ) << 8 ) | ( ( ( n_level >> 0 ) & 0xff ) << 16 );
 		p_n_b0[ n_level ] = ( ( n_level >> 0 ) & 0xff ) << 0;
@@ -649,6 +655,9 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 void psxgpu_device::device_post_load()
 {
+	/* words still being collected were written before the state was loaded */
+	m_write_pending.clear();
+
 	updatevisiblearea();
 }
 
@@ -666,6 +675,8 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	int n_overscantop;
 	int n_overscanleft;
 
+	sync_writes();
+
 #if PSXGPU_DEBUG_VIEWER
 	if( DebugMeshDisplay( bitmap, cliprect ) )
 	{
@@ -880,6 +891,14 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	}
 }
 
+/* texel and background channels, scaled to index the shade and transparency tables */
+#define LEVEL_R( bgr ) ( ( ( bgr ) & ( MAX_LEVEL - 1 ) ) * MAX_SHADE )
+#define LEVEL_G( bgr ) ( ( ( ( bgr ) >> 5 ) & ( MAX_LEVEL - 1 ) ) * MAX_SHADE )
+#define LEVEL_B( bgr ) ( ( ( ( bgr ) >> 10 ) & ( MAX_LEVEL - 1 ) ) * MAX_SHADE )
+#define BACKGROUND_R( bgr ) ( ( ( ( bgr ) & ( MAX_LEVEL - 1 ) ) >> n_bshift ) * MAX_LEVEL )
+#define BACKGROUND_G( bgr ) ( ( ( ( ( bgr ) >> 5 ) & ( MAX_LEVEL - 1 ) ) >> n_bshift ) * MAX_LEVEL )
+#define BACKGROUND_B( bgr ) ( ( ( ( ( bgr ) >> 10 ) & ( MAX_LEVEL - 1 ) ) >> n_bshift ) * MAX_LEVEL )
+
 #define SPRITESETUP \
 	int n_dv; \
 	if( n_iy != 0 ) \
@@ -902,9 +921,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 
 #define TRANSPARENCYSETUP \
 	uint16_t *p_n_f = p_n_f1; \
-	uint16_t *p_n_redb = p_n_redb1; \
-	uint16_t *p_n_greenb = p_n_greenb1; \
-	uint16_t *p_n_blueb = p_n_blueb1; \
+	int n_bshift = 0; \
 	uint16_t *p_n_redtrans = p_n_redaddtrans; \
 	uint16_t *p_n_greentrans = p_n_greenaddtrans; \
 	uint16_t *p_n_bluetrans = p_n_blueaddtrans; \
@@ -916,9 +933,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		{ \
 		case 0x00: \
 			p_n_f = p_n_f05; \
-			p_n_redb = p_n_redb05; \
-			p_n_greenb = p_n_greenb05; \
-			p_n_blueb = p_n_blueb05; \
+			n_bshift = 1; \
 			p_n_redtrans = p_n_redaddtrans; \
 			p_n_greentrans = p_n_greenaddtrans; \
 			p_n_bluetrans = p_n_blueaddtrans; \
@@ -926,9 +941,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			break; \
 		case 0x01: \
 			p_n_f = p_n_f1; \
-			p_n_redb = p_n_redb1; \
-			p_n_greenb = p_n_greenb1; \
-			p_n_blueb = p_n_blueb1; \
+			n_bshift = 0; \
 			p_n_redtrans = p_n_redaddtrans; \
 			p_n_greentrans = p_n_greenaddtrans; \
 			p_n_bluetrans = p_n_blueaddtrans; \
@@ -936,9 +949,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			break; \
 		case 0x02: \
 			p_n_f = p_n_f1; \
-			p_n_redb = p_n_redb1; \
-			p_n_greenb = p_n_greenb1; \
-			p_n_blueb = p_n_blueb1; \
+			n_bshift = 0; \
 			p_n_redtrans = p_n_redsubtrans; \
 			p_n_greentrans = p_n_greensubtrans; \
 			p_n_bluetrans = p_n_bluesubtrans; \
@@ -946,9 +957,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			break; \
 		case 0x03: \
 			p_n_f = p_n_f025; \
-			p_n_redb = p_n_redb1; \
-			p_n_greenb = p_n_greenb1; \
-			p_n_blueb = p_n_blueb1; \
+			n_bshift = 0; \
 			p_n_redtrans = p_n_redaddtrans; \
 			p_n_greentrans = p_n_greenaddtrans; \
 			p_n_bluetrans = p_n_blueaddtrans; \
@@ -1016,9 +1025,9 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		while( n_distance > 0 ) \
 		{ \
 			WRITE_PIXEL( \
-				p_n_redtrans[ p_n_f[ MID_LEVEL | n_r.w.h ] | p_n_redb[ *( p_vram ) ] ] | \
-				p_n_greentrans[ p_n_f[ MID_LEVEL | n_g.w.h ] | p_n_greenb[ *( p_vram ) ] ] | \
-				p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b.w.h ] | p_n_blueb[ *( p_vram ) ] ] ) \
+				p_n_redtrans[ p_n_f[ MID_LEVEL | n_r.w.h ] | BACKGROUND_R( *( p_vram ) ) ] | \
+				p_n_greentrans[ p_n_f[ MID_LEVEL | n_g.w.h ] | BACKGROUND_G( *( p_vram ) ) ] | \
+				p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b.w.h ] | BACKGROUND_B( *( p_vram ) ) ] ) \
 			p_vram++; \
 			PIXELUPDATE \
 			n_distance--; \
@@ -1088,9 +1097,9 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		if( n_bgr != 0 ) \
 		{ \
 			WRITE_PIXEL( \
-				p_n_redshade[ p_n_redlevel[ n_bgr ] | n_r.w.h ] | \
-				p_n_greenshade[ p_n_greenlevel[ n_bgr ] | n_g.w.h ] | \
-				p_n_blueshade[ p_n_bluelevel[ n_bgr ] | n_b.w.h ] | \
+				p_n_redshade[ LEVEL_R( n_bgr ) | n_r.w.h ] | \
+				p_n_greenshade[ LEVEL_G( n_bgr ) | n_g.w.h ] | \
+				p_n_blueshade[ LEVEL_B( n_bgr ) | n_b.w.h ] | \
 				( n_bgr & 0x8000 ) ) \
 		} \
 		p_vram++; \
@@ -1104,17 +1113,17 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			if( ( n_bgr & 0x8000 ) != 0 ) \
 			{ \
 				WRITE_PIXEL( \
-					p_n_redtrans[ p_n_f[ p_n_redlevel[ n_bgr ] | n_r.w.h ] | p_n_redb[ *( p_vram ) ] ] | \
-					p_n_greentrans[ p_n_f[ p_n_greenlevel[ n_bgr ] | n_g.w.h ] | p_n_greenb[ *( p_vram ) ] ] | \
-					p_n_bluetrans[ p_n_f[ p_n_bluelevel[ n_bgr ] | n_b.w.h ] | p_n_blueb[ *( p_vram ) ] ] | \
+					p_n_redtrans[ p_n_f[ LEVEL_R( n_bgr ) | n_r.w.h ] | BACKGROUND_R( *( p_vram ) ) ] | \
+					p_n_greentrans[ p_n_f[ LEVEL_G( n_bgr ) | n_g.w.h ] | BACKGROUND_G( *( p_vram ) ) ] | \
+					p_n_bluetrans[ p_n_f[ LEVEL_B( n_bgr ) | n_b.w.h ] | BACKGROUND_B( *( p_vram ) ) ] | \
 					0x8000 ) \
 			} \
 			else \
 			{ \
 				WRITE_PIXEL( \
-					p_n_redshade[ p_n_redlevel[ n_bgr ] | n_r.w.h ] | \
-					p_n_greenshade[ p_n_greenlevel[ n_bgr ] | n_g.w.h ] | \
-					p_n_blueshade[ p_n_bluelevel[ n_bgr ] | n_b.w.h ] ) \
+					p_n_redshade[ LEVEL_R( n_bgr ) | n_r.w.h ] | \
+					p_n_greenshade[ LEVEL_G( n_bgr ) | n_g.w.h ] | \
+					p_n_blueshade[ LEVEL_B( n_bgr ) | n_b.w.h ] ) \
 			} \
 		} \
 		p_vram++; \
@@ -2143,9 +2152,9 @@ void psxgpu_device::MonochromeLine()
 			case 0x02:
 				/* transparency on */
 				WRITE_PIXEL(
-					p_n_redtrans[ p_n_f[ MID_LEVEL | n_r ] | p_n_redb[ *( p_vram ) ] ] |
-					p_n_greentrans[ p_n_f[ MID_LEVEL | n_g ] | p_n_greenb[ *( p_vram ) ] ] |
-					p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b ] | p_n_blueb[ *( p_vram ) ] ] )
+					p_n_redtrans[ p_n_f[ MID_LEVEL | n_r ] | BACKGROUND_R( *( p_vram ) ) ] |
+					p_n_greentrans[ p_n_f[ MID_LEVEL | n_g ] | BACKGROUND_G( *( p_vram ) ) ] |
+					p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b ] | BACKGROUND_B( *( p_vram ) ) ] )
 				break;
 			}
 		}
@@ -2254,9 +2263,9 @@ void psxgpu_device::GouraudLine()
 			case 0x02:
 				/* transparency on */
 				WRITE_PIXEL(
-					p_n_redtrans[ p_n_f[ MID_LEVEL | n_r.w.h ] | p_n_redb[ *( p_vram ) ] ] |
-					p_n_greentrans[ p_n_f[ MID_LEVEL | n_g.w.h ] | p_n_greenb[ *( p_vram ) ] ] |
-					p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b.w.h ] | p_n_blueb[ *( p_vram ) ] ] )
+					p_n_redtrans[ p_n_f[ MID_LEVEL | n_r.w.h ] | BACKGROUND_R( *( p_vram ) ) ] |
+					p_n_greentrans[ p_n_f[ MID_LEVEL | n_g.w.h ] | BACKGROUND_G( *( p_vram ) ) ] |
+					p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b.w.h ] | BACKGROUND_B( *( p_vram ) ) ] )
 				break;
 			}
 		}
@@ -2671,9 +2680,9 @@ void psxgpu_device::Dot()
 		case 0x02:
 			/* transparency on */
 			WRITE_PIXEL(
-				p_n_redtrans[ p_n_f[ MID_LEVEL | n_r ] | p_n_redb[ *( p_vram ) ] ] |
-				p_n_greentrans[ p_n_f[ MID_LEVEL | n_g ] | p_n_greenb[ *( p_vram ) ] ] |
-				p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b ] | p_n_blueb[ *( p_vram ) ] ] )
+				p_n_redtrans[ p_n_f[ MID_LEVEL | n_r ] | BACKGROUND_R( *( p_vram ) ) ] |
+				p_n_greentrans[ p_n_f[ MID_LEVEL | n_g ] | BACKGROUND_G( *( p_vram ) ) ] |
+				p_n_bluetrans[ p_n_f[ MID_LEVEL | n_b ] | BACKGROUND_B( *( p_vram ) ) ] )
 			break;
 		}
 	}
@@ -2758,7 +2767,70 @@ void psxgpu_device::MoveImage()
 
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
-	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	queue_write( &p_n_psxram[ n_address / 4 ], n_size, true );
+}
+
+/* GP0 words are copied and handed to the worker in order, so that drawing
+   overlaps with emulating the CPU; words written one at a time by the CPU
+   are collected until a DMA, a sync or a full batch */
+
+void psxgpu_device::queue_write( const uint32_t *p_ram, int32_t n_size, bool submit )
+{
+	if( m_write_queue == nullptr )
+	{
+		gpu_write( const_cast<uint32_t *>( p_ram ), n_size );
+		return;
+	}
+
+	m_write_pending.insert( m_write_pending.end(), p_ram, p_ram + n_size );
+	if( submit || m_write_pending.size() >= 0x400 )
+	{
+		submit_writes();
+	}
+}
+
+void psxgpu_device::submit_writes()
+{
+	if( m_write_pending.empty() )
+	{
+		return;
+	}
+
+	write_batch *batch = new write_batch;
+	batch->gpu = this;
+	batch->words.swap( m_write_pending );
+	osd_work_item_queue( m_write_queue, write_batch_callback, batch, WORK_ITEM_FLAG_AUTO_RELEASE );
+}
+
+void *psxgpu_device::write_batch_callback( void *param, int threadid )
+{
+	std::unique_ptr<write_batch> batch( (write_batch *)param );
+	batch->gpu->gpu_write( &batch->words[ 0 ], batch->words.size() );
+	return nullptr;
+}
+
+/* a batch still being drawn would race with a state load, so loading waits
+   for the worker but leaves the collected words to device_post_load */
+
+void psxgpu_device::wait_writes()
+{
+	/* the queue has a single thread, so batches have run in order once it is idle */
+	osd_work_queue_wait( m_write_queue, osd_ticks_per_second() * 100 );
+}
+
+void psxgpu_device::sync_writes()
+{
+	if( m_write_queue == nullptr )
+	{
+		return;
+	}
+
+	wait_writes();
+	if( !m_write_pending.empty() )
+	{
+		gpu_write( &m_write_pending[ 0 ], m_write_pending.size() );
+		m_write_pending.clear();
+	}
 }
 
 void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
@@ -3269,9 +3341,10 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 	switch( offset )
 	{
 	case 0x00:
-		gpu_write( &data, 1 );
+		queue_write( &data, 1, false );
 		break;
 	case 0x01:
+		sync_writes();
 		switch( data >> 24 )
 		{
 		case 0x00:
@@ -3409,6 +3482,7 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 
 void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
+	sync_writes();
 	gpu_read( &p_n_psxram[ n_address / 4 ], n_size );
 }
 
@@ -3463,6 +3537,8 @@ uint32_t psxgpu_device::read(offs_t offset, uint32_t mem_mask)
 {
 	uint32_t data;
 
+	sync_writes();
+
 	switch( offset )
 	{
 	case 0x00:
@@ -3488,6 +3564,7 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 		DebugCheckKeys();
 #endif
 
+		sync_writes();
 		n_gpustatus ^= ( 1L << 31 );
 		m_vblank_handler(1);
 	}
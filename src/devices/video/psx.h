@@ -49,6 +49,7 @@ protected:
 	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_post_load() override;
 	virtual void device_reset() override;
 	virtual void device_config_complete() override;
@@ -219,6 +220,23 @@ private:
 	void gpu_read( uint32_t *p_ram, int32_t n_size );
 	void gpu_write( uint32_t *p_ram, int32_t n_size );
 
+	// GP0 words can be processed in order on a worker thread; anything that
+	// observes GPU state from outside calls sync_writes() first
+	struct write_batch
+	{
+		psxgpu_device *gpu;
+		std::vector<uint32_t> words;
+	};
+
+	static void *write_batch_callback( void *param, int threadid );
+	void queue_write( const uint32_t *p_ram, int32_t n_size, bool submit );
+	void submit_writes();
+	void wait_writes();
+	void sync_writes();
+
+	osd_work_queue *m_write_queue;
+	std::vector<uint32_t> m_write_pending;
+
 	int32_t m_n_tx;
 	int32_t m_n_ty;
 	int32_t n_abr;
@@ -265,19 +283,10 @@ private:
 	uint16_t p_n_redshade[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_greenshade[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_blueshade[ MAX_LEVEL * MAX_SHADE ];
-	uint16_t p_n_redlevel[ 0x10000 ];
-	uint16_t p_n_greenlevel[ 0x10000 ];
-	uint16_t p_n_bluelevel[ 0x10000 ];
 
 	uint16_t p_n_f025[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_f05[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_f1[ MAX_LEVEL * MAX_SHADE ];
-	uint16_t p_n_redb05[ 0x10000 ];
-	uint16_t p_n_greenb05[ 0x10000 ];
-	uint16_t p_n_blueb05[ 0x10000 ];
-	uint16_t p_n_redb1[ 0x10000 ];
-	uint16_t p_n_greenb1[ 0x10000 ];
-	uint16_t p_n_blueb1[ 0x10000 ];
 	uint16_t p_n_redaddtrans[ MAX_LEVEL * MAX_LEVEL ];
 	uint16_t p_n_greenaddtrans[ MAX_LEVEL * MAX_LEVEL ];
 	uint16_t p_n_blueaddtrans[ MAX_LEVEL * MAX_LEVEL ];
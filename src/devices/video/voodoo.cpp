@@ -146,6 +146,7 @@ bits(7:4) and bit(24)), X, and Y:
 #include "voodoo.h"
 #include "vooddefs.ipp"
 
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -171,6 +172,9 @@ bits(7:4) and bit(24)), X, and Y:
 #define LOG_CMDFIFO_VERBOSE (0)
 #define LOG_BANSHEE_2D      (0)
 
+/* use the keyed rasterizers instead of the fully generic ones for unlisted modes */
+#define USE_KEYED_RASTERIZERS   (1)
+
 #define MODIFY_PIXEL(VV)
 
 // Need to turn off cycle eating when debugging MIPS drc
@@ -809,6 +813,21 @@ const voodoo_device::raster_info voodoo_device::predef_raster_table[] =
 
 #undef RASTERIZER_ENTRY
 
+#define RASTERIZER_KEYED_ROW(tmus) \
+	{ raster_keyed_##tmus##tmu_0,  raster_keyed_##tmus##tmu_1,  raster_keyed_##tmus##tmu_2,  raster_keyed_##tmus##tmu_3, \
+		raster_keyed_##tmus##tmu_4,  raster_keyed_##tmus##tmu_5,  raster_keyed_##tmus##tmu_6,  raster_keyed_##tmus##tmu_7, \
+		raster_keyed_##tmus##tmu_8,  raster_keyed_##tmus##tmu_9,  raster_keyed_##tmus##tmu_10, raster_keyed_##tmus##tmu_11, \
+		raster_keyed_##tmus##tmu_12, raster_keyed_##tmus##tmu_13, raster_keyed_##tmus##tmu_14, raster_keyed_##tmus##tmu_15 },
+
+const poly_draw_scanline_func voodoo_device::keyed_raster_table[3][16] =
+{
+	RASTERIZER_KEYED_ROW(0)
+	RASTERIZER_KEYED_ROW(1)
+	RASTERIZER_KEYED_ROW(2)
+};
+
+#undef RASTERIZER_KEYED_ROW
+
 
 
 /***************************************************************************
@@ -1415,6 +1434,13 @@ void voodoo_device::swap_buffers(voodoo_device *vd)
 	if (LOG_RASTERIZERS && vd->stats.swaps % 1000 == 0)
 		dump_rasterizer_stats(vd);
 
+	/* publish the per-frame counters as outputs */
+	if (vd->machine().options().poly_stats())
+	{
+		vd->update_statistics(true);
+		vd->publish_statistics();
+	}
+
 	/* update the statistics (debug) */
 	if (vd->stats.display)
 	{
@@ -6316,6 +6342,7 @@ voodoo_device::raster_info *voodoo_device::add_rasterizer(voodoo_device *vd, con
 	/* fill in the data */
 	info->hits = 0;
 	info->polys = 0;
+	info->published_polys = 0;
 	info->hash = hash;
 
 	/* hook us into the hash table */
@@ -6376,8 +6403,19 @@ voodoo_device::raster_info *voodoo_device::find_rasterizer(voodoo_device *vd, in
 			return info;
 		}
 
-	/* generate a new one using the generic entry */
-	curinfo.callback = (texcount == 0) ? raster_generic_0tmu : (texcount == 1) ? raster_generic_1tmu : raster_generic_2tmu;
+	/* generate a new one; the keyed rasterizers fix the main feature enables */
+	/* at compile time and take the remaining mode bits from the raster info */
+	if (USE_KEYED_RASTERIZERS)
+	{
+		int key = FBZMODE_ENABLE_DEPTHBUF(curinfo.eff_fbz_mode) |
+				(ALPHAMODE_ALPHABLEND(curinfo.eff_alpha_mode) << 1) |
+				(FOGMODE_ENABLE_FOG(curinfo.eff_fog_mode) << 2) |
+				(ALPHAMODE_ALPHATEST(curinfo.eff_alpha_mode) << 3);
+		curinfo.callback = keyed_raster_table[texcount][key];
+		curinfo.is_keyed = true;
+	}
+	else
+		curinfo.callback = (texcount == 0) ? raster_generic_0tmu : (texcount == 1) ? raster_generic_1tmu : raster_generic_2tmu;
 	curinfo.is_generic = true;
 	curinfo.display = 0;
 	curinfo.polys = 0;
@@ -6426,7 +6464,7 @@ void voodoo_device::dump_rasterizer_stats(voodoo_device *vd)
 			best->eff_fbz_mode,
 			best->eff_tex_mode_0,
 			best->eff_tex_mode_1,
-			best->is_generic ? '*' : ' ',
+			best->is_keyed ? '+' : best->is_generic ? '*' : ' ',
 			best->hash,
 			best->polys,
 			best->hits);
@@ -6436,6 +6474,79 @@ void voodoo_device::dump_rasterizer_stats(voodoo_device *vd)
 	}
 }
 
+/*-------------------------------------------------
+    publish_statistics - set outputs to the
+    counters for the frame just swapped, for Lua
+    scripts and output clients
+-------------------------------------------------*/
+
+void voodoo_device::publish_statistics()
+{
+	output_manager &output = machine().output();
+	auto const publish = [this, &output] (const char *name, int32_t value)
+	{
+		output.set_value(string_format("%s.%s", basetag(), name).c_str(), value);
+	};
+
+	publish("triangles", stats.total_triangles);
+	publish("pixels_in", stats.total_pixels_in);
+	publish("pixels_out", stats.total_pixels_out);
+	publish("chroma_fail", stats.total_chroma_fail);
+	publish("zfunc_fail", stats.total_zfunc_fail);
+	publish("afunc_fail", stats.total_afunc_fail);
+	publish("clipped", stats.total_clipped);
+	publish("stippled", stats.total_stippled);
+	publish("reg_writes", stats.reg_writes);
+	publish("lfb_writes", stats.lfb_writes);
+	publish("tex_writes", stats.tex_writes);
+	publish("stalls", stats.stalls);
+
+	/* triangles by rasterizer kind, to see what still goes through the generic ones */
+	int32_t polys[3] = { 0, 0, 0 };
+	for (int index = 0; index < next_rasterizer; index++)
+	{
+		raster_info &info = rasterizer[index];
+		polys[info.is_keyed ? 1 : info.is_generic ? 2 : 0] += info.polys - info.published_polys;
+		info.published_polys = info.polys;
+	}
+	publish("polys_fixed", polys[0]);
+	publish("polys_keyed", polys[1]);
+	publish("polys_generic", polys[2]);
+}
+
+
+/*-------------------------------------------------
+    report_rasterizers - list the rasterizer
+    combinations this game used, busiest first,
+    in a form that can be pasted into
+    voodoo_rast.ipp
+-------------------------------------------------*/
+
+void voodoo_device::report_rasterizers()
+{
+	std::vector<const raster_info *> used;
+	for (int index = 0; index < next_rasterizer; index++)
+		if (rasterizer[index].polys != 0)
+			used.push_back(&rasterizer[index]);
+	if (used.empty())
+		return;
+	std::stable_sort(used.begin(), used.end(), [] (const raster_info *a, const raster_info *b) { return a->hits > b->hits; });
+
+	int keyed = 0, generic = 0;
+	for (const raster_info *info : used)
+		if (info->is_keyed)
+			keyed++;
+		else if (info->is_generic)
+			generic++;
+	osd_printf_verbose("%s: %d rasterizer combinations used (%d predefined, %d keyed, %d generic)\n", tag(), int(used.size()), int(used.size()) - keyed - generic, keyed, generic);
+	for (const raster_info *info : used)
+		osd_printf_verbose("RASTERIZER_ENTRY( 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X ) /* %c %8d %10d */\n",
+				info->eff_color_path, info->eff_alpha_mode, info->eff_fog_mode, info->eff_fbz_mode,
+				info->eff_tex_mode_0, info->eff_tex_mode_1,
+				info->is_keyed ? '+' : info->is_generic ? '*' : ' ',
+				info->polys, info->hits);
+}
+
 voodoo_device::voodoo_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, uint8_t vdt)
 	: device_t(mconfig, type, tag, owner, clock)
 	, m_fbmem(0)
@@ -6490,6 +6601,10 @@ void voodoo_device::device_stop()
 	/* release the work queue, ensuring all work is finished */
 	if (poly != nullptr)
 		poly_free(poly);
+
+	/* list the rasterizer combinations this game needs */
+	if (machine().options().verbose())
+		report_rasterizers();
 }
 
 
@@ -6609,3 +6724,35 @@ RASTERIZER(generic_1tmu, 1, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg
 
 RASTERIZER(generic_2tmu, 2, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg[alphaMode].u,
 			vd->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, vd->tmu[1].reg[textureMode].u)
+
+
+/*-------------------------------------------------
+    keyed_Ntmu_K - rasterizers for N TMUs with the
+    depth buffer (bit 0), alpha blend (bit 1),
+    fog (bit 2) and alpha test (bit 3) enables
+    from K fixed; everything else comes from the
+    effective modes recorded in the raster info
+-------------------------------------------------*/
+
+#define KEYED_FBZMODE(key)      ((extra->info->eff_fbz_mode & ~(1 << 4)) | (((key) & 1) << 4))
+#define KEYED_ALPHAMODE(key)    ((extra->info->eff_alpha_mode & ~((1 << 0) | (1 << 4))) | ((((key) >> 3) & 1) << 0) | ((((key) >> 1) & 1) << 4))
+#define KEYED_FOGMODE(key)      ((extra->info->eff_fog_mode & ~1) | (((key) >> 2) & 1))
+
+#define RASTERIZER_KEYED(tmus, key) \
+	RASTERIZER(keyed_##tmus##tmu_##key, tmus, extra->info->eff_color_path, KEYED_FBZMODE(key), KEYED_ALPHAMODE(key), \
+			KEYED_FOGMODE(key), extra->info->eff_tex_mode_0, extra->info->eff_tex_mode_1)
+#define RASTERIZER_KEYED_SET(tmus) \
+	RASTERIZER_KEYED(tmus, 0)  RASTERIZER_KEYED(tmus, 1)  RASTERIZER_KEYED(tmus, 2)  RASTERIZER_KEYED(tmus, 3) \
+	RASTERIZER_KEYED(tmus, 4)  RASTERIZER_KEYED(tmus, 5)  RASTERIZER_KEYED(tmus, 6)  RASTERIZER_KEYED(tmus, 7) \
+	RASTERIZER_KEYED(tmus, 8)  RASTERIZER_KEYED(tmus, 9)  RASTERIZER_KEYED(tmus, 10) RASTERIZER_KEYED(tmus, 11) \
+	RASTERIZER_KEYED(tmus, 12) RASTERIZER_KEYED(tmus, 13) RASTERIZER_KEYED(tmus, 14) RASTERIZER_KEYED(tmus, 15)
+
+RASTERIZER_KEYED_SET(0)
+RASTERIZER_KEYED_SET(1)
+RASTERIZER_KEYED_SET(2)
+
+#undef RASTERIZER_KEYED_SET
+#undef RASTERIZER_KEYED
+#undef KEYED_FOGMODE
+#undef KEYED_ALPHAMODE
+#undef KEYED_FBZMODE
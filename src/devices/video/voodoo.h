@@ -1210,6 +1210,8 @@ protected:
 		uint32_t            eff_tex_mode_0;         // effective textureMode value for TMU #0
 		uint32_t            eff_tex_mode_1;         // effective textureMode value for TMU #1
 		uint32_t            hash = 0U;
+		bool                is_keyed = false;       // true if this uses one of the keyed rasterizers
+		uint32_t            published_polys = 0;    // polys at the last publish_statistics
 	};
 
 
@@ -1247,6 +1249,7 @@ protected:
 
 
 	static const raster_info predef_raster_table[];
+	static const poly_draw_scanline_func keyed_raster_table[3][16];
 
 	// not all of these need to be static, review.
 
@@ -1272,6 +1275,8 @@ protected:
 	static raster_info *add_rasterizer(voodoo_device *vd, const raster_info *cinfo);
 	static raster_info *find_rasterizer(voodoo_device *vd, int texcount);
 	static void dump_rasterizer_stats(voodoo_device *vd);
+	void report_rasterizers();
+	void publish_statistics();
 
 	void accumulate_statistics(const stats_block &block);
 	void update_statistics(bool accumulate);
@@ -1300,6 +1305,17 @@ protected:
 
 #undef RASTERIZER_ENTRY
 
+#define RASTERIZER_KEYED_HEADERS(tmus) \
+	RASTERIZER_HEADER(keyed_##tmus##tmu_0)  RASTERIZER_HEADER(keyed_##tmus##tmu_1)  RASTERIZER_HEADER(keyed_##tmus##tmu_2)  RASTERIZER_HEADER(keyed_##tmus##tmu_3) \
+	RASTERIZER_HEADER(keyed_##tmus##tmu_4)  RASTERIZER_HEADER(keyed_##tmus##tmu_5)  RASTERIZER_HEADER(keyed_##tmus##tmu_6)  RASTERIZER_HEADER(keyed_##tmus##tmu_7) \
+	RASTERIZER_HEADER(keyed_##tmus##tmu_8)  RASTERIZER_HEADER(keyed_##tmus##tmu_9)  RASTERIZER_HEADER(keyed_##tmus##tmu_10) RASTERIZER_HEADER(keyed_##tmus##tmu_11) \
+	RASTERIZER_HEADER(keyed_##tmus##tmu_12) RASTERIZER_HEADER(keyed_##tmus##tmu_13) RASTERIZER_HEADER(keyed_##tmus##tmu_14) RASTERIZER_HEADER(keyed_##tmus##tmu_15)
+RASTERIZER_KEYED_HEADERS(0)
+RASTERIZER_KEYED_HEADERS(1)
+RASTERIZER_KEYED_HEADERS(2)
+
+#undef RASTERIZER_KEYED_HEADERS
+
 	static bool chromaKeyTest(voodoo_device *vd, stats_block *stats, uint32_t fbzModeReg, rgbaint_t rgaIntColor);
 	static bool alphaMaskTest(stats_block *stats, uint32_t fbzModeReg, uint8_t alpha);
 	static bool alphaTest(uint8_t alpharef, stats_block *stats, uint32_t alphaModeReg, uint8_t alpha);
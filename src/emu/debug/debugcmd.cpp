@@ -169,6 +169,8 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("over",      CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_over, this, _1, _2));
 	m_console.register_command("o",         CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_over, this, _1, _2));
 	m_console.register_command("out" ,      CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_out, this, _1, _2));
+	m_console.register_command("backstep",  CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_backstep, this, _1, _2));
+	m_console.register_command("bs",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_backstep, this, _1, _2));
 	m_console.register_command("go",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_go, this, _1, _2));
 	m_console.register_command("g",         CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_go, this, _1, _2));
 	m_console.register_command("gvblank",   CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_go_vblank, this, _1, _2));
@@ -297,6 +299,17 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("pcatmemi",  CMDFLAG_NONE, AS_IO,      1, 2, std::bind(&debugger_commands::execute_pcatmem, this, _1, _2));
 	m_console.register_command("pcatmemo",  CMDFLAG_NONE, AS_OPCODES, 1, 2, std::bind(&debugger_commands::execute_pcatmem, this, _1, _2));
 
+	m_console.register_command("memhist",   CMDFLAG_NONE, AS_PROGRAM, 0, 3, std::bind(&debugger_commands::execute_memhist, this, _1, _2));
+	m_console.register_command("memhistp",  CMDFLAG_NONE, AS_PROGRAM, 0, 3, std::bind(&debugger_commands::execute_memhist, this, _1, _2));
+	m_console.register_command("memhistd",  CMDFLAG_NONE, AS_DATA,    0, 3, std::bind(&debugger_commands::execute_memhist, this, _1, _2));
+	m_console.register_command("memhisti",  CMDFLAG_NONE, AS_IO,      0, 3, std::bind(&debugger_commands::execute_memhist, this, _1, _2));
+	m_console.register_command("memhisto",  CMDFLAG_NONE, AS_OPCODES, 0, 3, std::bind(&debugger_commands::execute_memhist, this, _1, _2));
+	m_console.register_command("lastwrite", CMDFLAG_NONE, AS_PROGRAM, 1, 3, std::bind(&debugger_commands::execute_lastwrite, this, _1, _2));
+	m_console.register_command("lastwritep", CMDFLAG_NONE, AS_PROGRAM, 1, 3, std::bind(&debugger_commands::execute_lastwrite, this, _1, _2));
+	m_console.register_command("lastwrited", CMDFLAG_NONE, AS_DATA,    1, 3, std::bind(&debugger_commands::execute_lastwrite, this, _1, _2));
+	m_console.register_command("lastwritei", CMDFLAG_NONE, AS_IO,      1, 3, std::bind(&debugger_commands::execute_lastwrite, this, _1, _2));
+	m_console.register_command("lastwriteo", CMDFLAG_NONE, AS_OPCODES, 1, 3, std::bind(&debugger_commands::execute_lastwrite, this, _1, _2));
+
 	m_console.register_command("snap",      CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_snap, this, _1, _2));
 
 	m_console.register_command("source",    CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_source, this, _1, _2));
@@ -928,6 +941,22 @@ void debugger_commands::execute_step(int ref, const std::vector<std::string> &pa
 }
 
 
+/*-------------------------------------------------
+    execute_backstep - execute the backstep command
+-------------------------------------------------*/
+
+void debugger_commands::execute_backstep(int ref, const std::vector<std::string> &params)
+{
+	/* if we have a parameter, use it */
+	u64 steps = 1;
+	if (params.size() > 0 && !validate_number_parameter(params[0], steps))
+		return;
+
+	if (!m_console.get_visible_cpu()->debug()->reverse_step(steps))
+		m_console.printf("No snapshot from before that instruction; use memhist to take snapshots\n");
+}
+
+
 /*-------------------------------------------------
     execute_over - execute the over command
 -------------------------------------------------*/
@@ -1919,6 +1948,7 @@ void debugger_commands::execute_stateload(int ref, const std::vector<std::string
 		device.debug()->track_pc_data_clear();
 		device.debug()->track_mem_data_clear();
 	}
+	m_cpu.memory_history().clear();
 	m_console.printf("State load attempted.  Please refer to window message popup for results.\n");
 }
 
@@ -1931,12 +1961,15 @@ void debugger_commands::execute_rewind(int ref, const std::vector<std::string> &
 {
 	bool success = m_machine.rewind_step();
 	if (success)
+	{
 		// clear all PC & memory tracks
 		for (device_t &device : device_iterator(m_machine.root_device()))
 		{
 			device.debug()->track_pc_data_clear();
 			device.debug()->track_mem_data_clear();
 		}
+		m_cpu.memory_history().clear();
+	}
 	else
 		m_console.printf("Rewind error occured.  See error.log for details.\n");
 }
@@ -3183,6 +3216,8 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
+	u8 binary_options = 0;
 	device_t *cpu;
 	FILE *f = nullptr;
 	const char *mode;
@@ -3206,6 +3241,18 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "binary"))
+				binary = true;
+			else if (!core_stricmp(flag.c_str(), "regs"))
+			{
+				binary = true;
+				binary_options |= util::trace_format::OPTION_REGISTERS;
+			}
+			else if (!core_stricmp(flag.c_str(), "mem"))
+			{
+				binary = true;
+				binary_options |= util::trace_format::OPTION_MEMORY;
+			}
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag.c_str());
@@ -3219,12 +3266,12 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	/* open the file */
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		/* opening for append? */
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -3237,7 +3284,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	}
 
 	/* do it */
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action, binary, binary_options);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename.c_str());
 	else
@@ -3458,6 +3505,107 @@ void debugger_commands::execute_pcatmem(int ref, const std::vector<std::string>
 }
 
 
+/*-------------------------------------------------
+    execute_memhist - execute the memhist command
+-------------------------------------------------*/
+
+void debugger_commands::execute_memhist(int ref, const std::vector<std::string> &params)
+{
+	// Gather the on/off switch (if present)
+	bool turnOn = true;
+	if (params.size() > 0 && !validate_boolean_parameter(params[0], turnOn))
+		return;
+
+	// Get the address space for the given cpu
+	address_space *space;
+	if (!validate_cpu_space_parameter((params.size() > 1) ? params[1].c_str() : nullptr, ref, space))
+		return;
+
+	// Gather the snapshot interval (if present)
+	u64 interval = 1000000;
+	if (params.size() > 2 && !validate_number_parameter(params[2], interval))
+		return;
+
+	device_debug &debug = *space->device().debug();
+	debug.memory_history_record(space->spacenum(), turnOn);
+
+	// snapshots are paced by a CPU's instructions
+	if (dynamic_cast<device_execute_interface *>(&space->device()) != nullptr)
+	{
+		bool recording = false;
+		for (int i = 0; i < space->device().memory().max_space_count(); i++)
+			recording = recording || debug.memory_history_recording(i);
+		debug.memory_history_snapshots(recording ? interval : 0);
+	}
+
+	if (turnOn)
+		m_console.printf("Recording accesses to '%s' %s space\n", space->device().tag(), space->name());
+	else
+		m_console.printf("Stopped recording accesses to '%s' %s space\n", space->device().tag(), space->name());
+}
+
+
+/*-------------------------------------------------
+    execute_lastwrite - execute the lastwrite
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_lastwrite(int ref, const std::vector<std::string> &params)
+{
+	// Gather the required address parameter
+	u64 address;
+	if (!validate_number_parameter(params[0], address))
+		return;
+
+	// Get the address space for the given cpu
+	address_space *space;
+	if (!validate_cpu_space_parameter((params.size() > 1) ? params[1].c_str() : nullptr, ref, space))
+		return;
+
+	// Gather the number of writes to show (if present)
+	u64 count = 1;
+	if (params.size() > 2 && !validate_number_parameter(params[2], count))
+		return;
+
+	// Translate the address
+	offs_t a = address & space->logaddrmask();
+	if (!space->device().memory().translate(space->spacenum(), TRANSLATE_WRITE_DEBUG, a))
+	{
+		m_console.printf("Bad address\n");
+		return;
+	}
+	a &= space->addrmask();
+
+	// Print the writes, newest first
+	auto const writes = m_cpu.memory_history().find(*space, a, true, int(std::min<u64>(count, 0x7fffffff)));
+	if (writes.empty())
+	{
+		if (!space->device().debug()->memory_history_recording(space->spacenum()))
+			m_console.printf("Not recording %s space; use memhist to start\n", space->name());
+		else
+			m_console.printf("No recorded writes to %0*X\n", space->addrchars(), a);
+		return;
+	}
+	for (auto const *entry : writes)
+	{
+		offs_t start;
+		u64 data;
+		int size;
+		entry->covers(a, start, data, size);
+		int const ashift = space->addr_shift();
+		int const unit_size = ashift <= 0 ? 8 << -ashift : 8 >> ashift;
+		if (entry->m_cpu != nullptr)
+			m_console.printf("'%s' PC=%0*X wrote %0*X to %0*X (instruction %d, cycle %d)\n",
+					entry->m_cpu->tag(), entry->m_cpu->debug()->logaddrchars(), entry->m_pc,
+					(size * unit_size + 3) / 4, data, space->addrchars(), start,
+					entry->m_instruction, entry->m_cycles);
+		else
+			m_console.printf("No CPU running wrote %0*X to %0*X\n",
+					(size * unit_size + 3) / 4, data, space->addrchars(), start);
+	}
+}
+
+
 /*-------------------------------------------------
     execute_snap - execute the snapshot command
 -------------------------------------------------*/
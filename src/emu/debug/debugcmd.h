@@ -112,6 +112,7 @@ private:
 	void execute_step(int ref, const std::vector<std::string> &params);
 	void execute_over(int ref, const std::vector<std::string> &params);
 	void execute_out(int ref, const std::vector<std::string> &params);
+	void execute_backstep(int ref, const std::vector<std::string> &params);
 	void execute_go(int ref, const std::vector<std::string> &params);
 	void execute_go_vblank(int ref, const std::vector<std::string> &params);
 	void execute_go_interrupt(int ref, const std::vector<std::string> &params);
@@ -165,6 +166,8 @@ private:
 	void execute_trackpc(int ref, const std::vector<std::string> &params);
 	void execute_trackmem(int ref, const std::vector<std::string> &params);
 	void execute_pcatmem(int ref, const std::vector<std::string> &params);
+	void execute_memhist(int ref, const std::vector<std::string> &params);
+	void execute_lastwrite(int ref, const std::vector<std::string> &params);
 	void execute_snap(int ref, const std::vector<std::string> &params);
 	void execute_source(int ref, const std::vector<std::string> &params);
 	void execute_map(int ref, const std::vector<std::string> &params);
@@ -26,6 +26,8 @@
 #include "osdepend.h"
 #include "xmlfile.h"
 
+#include <zlib.h>
+
 
 const size_t debugger_cpu::NUM_TEMP_VARIABLES = 10;
 
@@ -49,6 +51,7 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_wpaddr(0)
 	, m_last_periodic_update_time(0)
 	, m_comments_loaded(false)
+	, m_memory_history(std::make_unique<debug_memory_history>(machine))
 {
 	m_tempvar = make_unique_clear<u64[]>(NUM_TEMP_VARIABLES);
 
@@ -430,13 +433,23 @@ device_debug::device_debug(device_t &device)
 	, m_endexectime(attotime::zero)
 	, m_total_cycles(0)
 	, m_last_total_cycles(0)
+	, m_instruction_count(0)
+	, m_stopcount(0)
 	, m_pc_history_index(0)
 	, m_bplist()
 	, m_rplist(std::make_unique<std::forward_list<debug_registerpoint>>())
+	, m_bpfilter()
+	, m_wptaps()
+	, m_wpcleared()
+	, m_wpdispatching(false)
+	, m_wpinstalling(false)
 	, m_triggered_breakpoint(nullptr)
 	, m_triggered_watchpoint(nullptr)
 	, m_trace(nullptr)
 	, m_hotspot_threshhold(0)
+	, m_memhist_spaces(0)
+	, m_snapshot_interval(0)
+	, m_snapshot_at(~u64(0))
 	, m_track_pc_set()
 	, m_track_pc(false)
 	, m_comment_set()
@@ -460,7 +473,7 @@ device_debug::device_debug(device_t &device)
 		for (int i=0; i != count; i++)
 			if (m_memory->has_space(i)) {
 				address_space &space = m_memory->space(i);
-				m_notifiers.push_back(space.add_change_notifier([this, &space](read_or_write mode) { reinstall(space, mode); }));
+				m_notifiers.push_back(space.add_change_notifier([this, &space](read_or_write mode) { reinstall(space, mode); watchpoint_install(space, mode); }));
 			}
 			else
 				m_notifiers.push_back(-1);
@@ -546,6 +559,15 @@ device_debug::~device_debug()
 	breakpoint_clear_all();
 	watchpoint_clear_all();
 	registerpoint_clear_all();
+
+	// the watchpoint taps call back into us
+	for (watchpoint_taps &taps : m_wptaps)
+	{
+		if (taps.m_phr)
+			taps.m_phr->remove();
+		if (taps.m_phw)
+			taps.m_phw->remove();
+	}
 }
 
 void device_debug::write_tracking(address_space &space, offs_t address, u64 data)
@@ -571,6 +593,14 @@ void device_debug::reinstall(address_space &space, read_or_write mode)
 			case 32: m_phr[id] = space.install_read_tap(0, space.addrmask(), "hotspot", [this, &space](offs_t address, u32 &, u32) { hotspot_check(space, address); }, m_phr[id]); break;
 			case 64: m_phr[id] = space.install_read_tap(0, space.addrmask(), "hotspot", [this, &space](offs_t address, u64 &, u64) { hotspot_check(space, address); }, m_phr[id]); break;
 			}
+		if (BIT(m_memhist_spaces, id))
+			switch (space.data_width())
+			{
+			case  8: m_phr[id] = space.install_read_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u8  &data, u8  mem_mask) { memory_history_access(space, false, address, data, mem_mask); }, m_phr[id]); break;
+			case 16: m_phr[id] = space.install_read_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u16 &data, u16 mem_mask) { memory_history_access(space, false, address, data, mem_mask); }, m_phr[id]); break;
+			case 32: m_phr[id] = space.install_read_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u32 &data, u32 mem_mask) { memory_history_access(space, false, address, data, mem_mask); }, m_phr[id]); break;
+			case 64: m_phr[id] = space.install_read_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u64 &data, u64 mem_mask) { memory_history_access(space, false, address, data, mem_mask); }, m_phr[id]); break;
+			}
 	}
 	if (u32(mode) & u32(read_or_write::WRITE))
 	{
@@ -584,6 +614,14 @@ void device_debug::reinstall(address_space &space, read_or_write mode)
 			case 32: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u32 &data, u32) { write_tracking(space, address, data); }, m_phw[id]); break;
 			case 64: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u64 &data, u64) { write_tracking(space, address, data); }, m_phw[id]); break;
 			}
+		if (BIT(m_memhist_spaces, id))
+			switch (space.data_width())
+			{
+			case  8: m_phw[id] = space.install_write_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u8  &data, u8  mem_mask) { memory_history_access(space, true, address, data, mem_mask); }, m_phw[id]); break;
+			case 16: m_phw[id] = space.install_write_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u16 &data, u16 mem_mask) { memory_history_access(space, true, address, data, mem_mask); }, m_phw[id]); break;
+			case 32: m_phw[id] = space.install_write_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u32 &data, u32 mem_mask) { memory_history_access(space, true, address, data, mem_mask); }, m_phw[id]); break;
+			case 64: m_phw[id] = space.install_write_tap(0, space.addrmask(), "memhist", [this, &space](offs_t address, u64 &data, u64 mem_mask) { memory_history_access(space, true, address, data, mem_mask); }, m_phw[id]); break;
+			}
 	}
 }
 
@@ -716,9 +754,6 @@ void device_debug::instruction_hook(offs_t curpc)
 	running_machine &machine = m_device.machine();
 	debugger_cpu& debugcpu = machine.debugger().cpu();
 
-	// note that we are in the debugger code
-	debugcpu.set_within_instruction(true);
-
 	// update the history
 	m_pc_history[m_pc_history_index++ % HISTORY_SIZE] = curpc;
 
@@ -726,6 +761,24 @@ void device_debug::instruction_hook(offs_t curpc)
 	m_last_total_cycles = m_total_cycles;
 	m_total_cycles = m_exec->total_cycles();
 
+	// take a snapshot for stepping backwards when it's due
+	if (++m_instruction_count == m_snapshot_at)
+	{
+		m_snapshot_at += m_snapshot_interval;
+		if (!debugcpu.memory_history().snapshot())
+			m_snapshot_at = ~u64(0);
+	}
+
+	// an execution breakpoint can only be here if the PC filter says so
+	const bool bpcheck = ((m_flags & DEBUG_FLAG_LIVE_BP) != 0 && breakpoint_maybe(curpc)) || (m_flags & DEBUG_FLAG_LIVE_RP) != 0;
+
+	// nothing else armed on this CPU and nothing waiting to stop: that's all
+	if ((m_flags & ~(DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP) & DEBUG_FLAG_ARMED) == 0 && !bpcheck && m_trace == nullptr && !m_track_pc && !debugcpu.is_stopped())
+		return;
+
+	// note that we are in the debugger code
+	debugcpu.set_within_instruction(true);
+
 	// are we tracking our recent pc visits?
 	if (m_track_pc)
 	{
@@ -766,7 +819,7 @@ void device_debug::instruction_hook(offs_t curpc)
 	}
 
 	// handle breakpoints
-	if (!debugcpu.is_stopped() && (m_flags & (DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	if (!debugcpu.is_stopped() && ((m_flags & (DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_STOP_COUNT)) != 0 || bpcheck))
 	{
 		// see if we hit a target time
 		if ((m_flags & DEBUG_FLAG_STOP_TIME) != 0 && machine.time() >= m_stoptime)
@@ -782,8 +835,14 @@ void device_debug::instruction_hook(offs_t curpc)
 			debugcpu.set_execution_stopped();
 		}
 
+		// check for the end of a replay after stepping backwards
+		else if ((m_flags & DEBUG_FLAG_STOP_COUNT) != 0 && m_instruction_count == m_stopcount)
+		{
+			debugcpu.set_execution_stopped();
+		}
+
 		// check for execution breakpoints
-		else if ((m_flags & DEBUG_FLAG_LIVE_BP) != 0)
+		else if (bpcheck)
 			breakpoint_check(curpc);
 	}
 
@@ -841,6 +900,10 @@ void device_debug::instruction_hook(offs_t curpc)
 		machine.debugger().console().set_visible_cpu(&m_device);
 	}
 
+	// bring the watchpoint taps up to date before the instruction runs
+	if ((m_flags & DEBUG_FLAG_WATCH_TAPS) != 0)
+		watchpoint_sync();
+
 	// handle step out/over on the instruction we are about to execute
 	if ((m_flags & (DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT)) != 0 && m_stepaddr == ~0)
 		prepare_for_step_overout(m_state->pcbase());
@@ -1181,11 +1244,15 @@ void device_debug::breakpoint_enable_all(bool enable)
 int device_debug::watchpoint_set(address_space &space, read_or_write type, offs_t address, offs_t length, const char *condition, const char *action)
 {
 	if (space.spacenum() >= int(m_wplist.size()))
+	{
 		m_wplist.resize(space.spacenum()+1);
+		m_wptaps.resize(space.spacenum()+1);
+	}
 
 	// allocate a new one
 	u32 id = m_device.machine().debugger().cpu().get_watchpoint_index();
 	m_wplist[space.spacenum()].emplace_back(std::make_unique<debug_watchpoint>(this, *m_symtable, id, space, type, address, length, condition, action));
+	watchpoint_update(space.spacenum());
 
 	return id;
 }
@@ -1199,12 +1266,17 @@ int device_debug::watchpoint_set(address_space &space, read_or_write type, offs_
 bool device_debug::watchpoint_clear(int index)
 {
 	// scan the list to see if we own this breakpoint
-	for (auto &wpl : m_wplist)
+	for (int spacenum = 0; spacenum < int(m_wplist.size()); ++spacenum)
 	{
+		auto &wpl = m_wplist[spacenum];
 		for (auto wpi = wpl.begin(); wpi != wpl.end(); wpi++)
 			if ((*wpi)->index() == index)
 			{
+				// a watchpoint action may be clearing its own watchpoint
+				if (m_wpdispatching)
+					m_wpcleared.emplace_back(std::move(*wpi));
 				wpl.erase(wpi);
+				watchpoint_update(spacenum);
 				return true;
 			}
 	}
@@ -1220,8 +1292,14 @@ bool device_debug::watchpoint_clear(int index)
 
 void device_debug::watchpoint_clear_all()
 {
-	for (auto &wpl : m_wplist)
+	for (int spacenum = 0; spacenum < int(m_wplist.size()); ++spacenum)
+	{
+		auto &wpl = m_wplist[spacenum];
+		if (m_wpdispatching)
+			std::move(wpl.begin(), wpl.end(), std::back_inserter(m_wpcleared));
 		wpl.clear();
+		watchpoint_update(spacenum);
+	}
 }
 
 
@@ -1233,11 +1311,15 @@ void device_debug::watchpoint_clear_all()
 bool device_debug::watchpoint_enable(int index, bool enable)
 {
 	// scan the list to see if we own this watchpoint
-	for (auto &wpl : m_wplist)
-		for (auto &wp : wpl)
+	for (int spacenum = 0; spacenum < int(m_wplist.size()); ++spacenum)
+		for (auto &wp : m_wplist[spacenum])
 			if (wp->index() == index)
 			{
-				wp->setEnabled(enable);
+				if (wp->m_enabled != enable)
+				{
+					wp->m_enabled = enable;
+					watchpoint_update(spacenum);
+				}
 				return true;
 			}
 
@@ -1254,9 +1336,12 @@ bool device_debug::watchpoint_enable(int index, bool enable)
 void device_debug::watchpoint_enable_all(bool enable)
 {
 	// apply the enable to all watchpoints we own
-	for (auto &wpl : m_wplist)
-		for (auto &wp : wpl)
-			wp->setEnabled(enable);
+	for (int spacenum = 0; spacenum < int(m_wplist.size()); ++spacenum)
+	{
+		for (auto &wp : m_wplist[spacenum])
+			wp->m_enabled = enable;
+		watchpoint_update(spacenum);
+	}
 }
 
 
@@ -1430,6 +1515,105 @@ offs_t device_debug::track_mem_pc_from_space_address_data(const int& space,
 }
 
 
+//-------------------------------------------------
+//  memory_history_record - start or stop
+//  recording the accesses to an address space
+//-------------------------------------------------
+
+void device_debug::memory_history_record(int spacenum, bool enable)
+{
+	assert(m_memory != nullptr && m_memory->has_space(spacenum));
+
+	if (enable)
+	{
+		m_device.machine().debugger().cpu().memory_history().enable();
+		m_memhist_spaces |= 1U << spacenum;
+	}
+	else
+	{
+		m_memhist_spaces &= ~(1U << spacenum);
+	}
+	reinstall(m_memory->space(spacenum), read_or_write::READWRITE);
+}
+
+
+//-------------------------------------------------
+//  memory_history_snapshots - take a snapshot
+//  every so many instructions, or never if the
+//  interval is zero
+//-------------------------------------------------
+
+void device_debug::memory_history_snapshots(u64 interval)
+{
+	assert(m_exec != nullptr);
+
+	// only one CPU paces the snapshots
+	if (interval != 0)
+		for (device_execute_interface &exec : execute_interface_iterator(m_device.machine().root_device()))
+			if (exec.device().debug() != nullptr)
+				exec.device().debug()->memory_history_snapshots(0);
+
+	m_snapshot_interval = interval;
+	m_snapshot_at = interval ? (m_instruction_count + 1) : ~u64(0);
+}
+
+
+//-------------------------------------------------
+//  reverse_step - go back the requested number
+//  of instructions by restoring a snapshot and
+//  running forward again; returns false if no
+//  snapshot is old enough
+//-------------------------------------------------
+
+bool device_debug::reverse_step(u64 numsteps)
+{
+	assert(m_exec != nullptr);
+
+	debugger_cpu &debugcpu = m_device.machine().debugger().cpu();
+	if (numsteps >= m_instruction_count)
+		return false;
+
+	// restore the newest snapshot at or before the target
+	u64 const target = m_instruction_count - numsteps;
+	u64 restored;
+	if (!debugcpu.memory_history().restore(*this, target, restored))
+		return false;
+	if (m_snapshot_interval)
+		m_snapshot_at = restored + m_snapshot_interval;
+
+	// the snapshot was taken just before instruction "restored" ran
+	if (restored < target)
+	{
+		m_stopcount = target;
+		m_flags |= DEBUG_FLAG_STOP_COUNT;
+		debugcpu.set_execution_running();
+	}
+	else
+	{
+		m_device.machine().debug_view().update_all();
+		m_device.machine().debugger().refresh_display();
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  memory_history_access - record an access to
+//  a space we're watching
+//-------------------------------------------------
+
+void device_debug::memory_history_access(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask)
+{
+	running_machine &machine = m_device.machine();
+
+	// ignore the debugger's own accesses
+	if (machine.debugger().cpu().within_instruction_hook() || machine.side_effects_disabled())
+		return;
+
+	machine.debugger().cpu().memory_history().record(space, write, address, data, mem_mask);
+}
+
+
 //-------------------------------------------------
 //  comment_add - adds a comment to the list at
 //  the given address
@@ -1551,14 +1735,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, u8 binary_options)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action, binary, binary_options);
 }
 
 
@@ -1603,7 +1787,7 @@ void device_debug::compute_debug_flags()
 
 	// if we're tracking history, or we're hooked, or stepping, or stopping at a breakpoint
 	// make sure we call the hook
-	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_STOP_COUNT | DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP | DEBUG_FLAG_WATCH_TAPS)) != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
 	// also call if we are tracing
@@ -1660,26 +1844,24 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
-	// see if there are any enabled breakpoints
-	m_flags &= ~DEBUG_FLAG_LIVE_BP;
+	// rebuild the PC filter from the enabled breakpoints
+	m_flags &= ~(DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP);
+	m_bpfilter.fill(0);
 	for (auto &bpp : m_bplist)
 		if (bpp.second->m_enabled)
 		{
+			const u32 h = breakpoint_hash(bpp.first);
+			m_bpfilter[h >> 6] |= u64(1) << (h & 63);
 			m_flags |= DEBUG_FLAG_LIVE_BP;
-			break;
 		}
 
-	if ( ! ( m_flags & DEBUG_FLAG_LIVE_BP ) )
-	{
-		// see if there are any enabled registerpoints
-		for (debug_registerpoint &rp : *m_rplist)
+	// see if there are any enabled registerpoints
+	for (debug_registerpoint &rp : *m_rplist)
+		if (rp.m_enabled)
 		{
-			if (rp.m_enabled)
-			{
-				m_flags |= DEBUG_FLAG_LIVE_BP;
-			}
+			m_flags |= DEBUG_FLAG_LIVE_RP;
+			break;
 		}
-	}
 
 	// push the flags out globally
 	if (m_device.machine().debugger().cpu().live_cpu() != nullptr)
@@ -1696,31 +1878,36 @@ void device_debug::breakpoint_check(offs_t pc)
 {
 	debugger_cpu& debugcpu = m_device.machine().debugger().cpu();
 
-	// see if we match
-	auto bpitp = m_bplist.equal_range(pc);
-	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
+	// see if we match; the filter is empty when no breakpoints are enabled
+	if (breakpoint_maybe(pc))
 	{
-		debug_breakpoint &bp = *bpit->second;
-		if (bp.hit(pc))
+		auto bpitp = m_bplist.equal_range(pc);
+		for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
 		{
-			// halt in the debugger by default
-			debugcpu.set_execution_stopped();
-
-			// if we hit, evaluate the action
-			if (!bp.m_action.empty())
-				m_device.machine().debugger().console().execute_command(bp.m_action, false);
-
-			// print a notification, unless the action made us go again
-			if (debugcpu.is_stopped())
+			debug_breakpoint &bp = *bpit->second;
+			if (bp.hit(pc))
 			{
-				m_device.machine().debugger().console().printf("Stopped at breakpoint %X\n", bp.m_index);
-				m_triggered_breakpoint = &bp;
+				// halt in the debugger by default
+				debugcpu.set_execution_stopped();
+
+				// if we hit, evaluate the action
+				if (!bp.m_action.empty())
+					m_device.machine().debugger().console().execute_command(bp.m_action, false);
+
+				// print a notification, unless the action made us go again
+				if (debugcpu.is_stopped())
+				{
+					m_device.machine().debugger().console().printf("Stopped at breakpoint %X\n", bp.m_index);
+					m_triggered_breakpoint = &bp;
+				}
+				break;
 			}
-			break;
 		}
 	}
 
 	// see if we have any matching registerpoints
+	if ((m_flags & DEBUG_FLAG_LIVE_RP) == 0)
+		return;
 	for (debug_registerpoint &rp : *m_rplist)
 	{
 		if (rp.hit())
@@ -1745,11 +1932,199 @@ void device_debug::breakpoint_check(offs_t pc)
 }
 
 
+//-------------------------------------------------
+//  watchpoint_update - rebuild the watchpoint
+//  spans for an address space after its
+//  watchpoints changed
+//-------------------------------------------------
+
+void device_debug::watchpoint_update(int spacenum)
+{
+	watchpoint_taps &taps = m_wptaps[spacenum];
+
+	// a watchpoint action changed the list; finish dispatching first
+	if (m_wpdispatching)
+	{
+		taps.m_dirty = true;
+		return;
+	}
+	taps.m_dirty = false;
+
+	bool changed = false;
+	for (int rw = 0; rw < 2; rw++)
+	{
+		read_or_write const type = rw ? read_or_write::WRITE : read_or_write::READ;
+
+		// collect the bounds of every enabled check of this type
+		std::vector<std::tuple<offs_t, offs_t, debug_watchpoint *, u64>> checks;
+		std::vector<u64> bounds;
+		for (auto &wp : m_wplist[spacenum])
+			if (wp->m_enabled && (u32(wp->m_type) & u32(type)))
+				for (int i = 0; i != 3; i++)
+					if (wp->m_masks[i])
+					{
+						checks.emplace_back(wp->m_start_address[i], wp->m_end_address[i], wp.get(), wp->m_masks[i]);
+						bounds.push_back(wp->m_start_address[i]);
+						bounds.push_back(u64(wp->m_end_address[i]) + 1);
+					}
+		std::sort(bounds.begin(), bounds.end());
+		bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+		// split the space at those bounds, keeping the pieces somebody watches
+		std::vector<watchpoint_span> spans;
+		for (size_t b = 1; b < bounds.size(); b++)
+		{
+			offs_t const start = bounds[b - 1];
+			offs_t const end = bounds[b] - 1;
+			std::vector<std::pair<debug_watchpoint *, u64>> points;
+			for (auto const &check : checks)
+				if (std::get<0>(check) <= start && std::get<1>(check) >= end)
+					points.emplace_back(std::get<2>(check), std::get<3>(check));
+			if (points.empty())
+				continue;
+			if (!spans.empty() && spans.back().m_end + 1 == start && spans.back().m_points == points)
+				spans.back().m_end = end;
+			else
+				spans.push_back(watchpoint_span{ start, end, std::move(points) });
+		}
+
+		// one tap covers each run of adjacent spans
+		std::vector<std::pair<offs_t, offs_t>> ranges;
+		for (auto const &span : spans)
+			if (!ranges.empty() && ranges.back().second + 1 == span.m_start)
+				ranges.back().second = span.m_end;
+			else
+				ranges.emplace_back(span.m_start, span.m_end);
+
+		taps.m_spans[rw] = std::move(spans);
+		if (ranges != taps.m_ranges[rw])
+		{
+			taps.m_ranges[rw] = std::move(ranges);
+			changed = true;
+		}
+	}
+	if (!changed)
+		return;
+
+	// observed CPUs reinstall their taps before the next instruction, so a
+	// batch of changes costs one pass over the handler tree
+	if (m_exec != nullptr && observing())
+	{
+		taps.m_stale = true;
+		m_flags |= DEBUG_FLAG_WATCH_TAPS;
+		if (m_device.machine().debugger().cpu().live_cpu() != nullptr)
+			m_device.machine().debugger().cpu().live_cpu()->debug()->compute_debug_flags();
+	}
+	else
+	{
+		watchpoint_install(m_memory->space(spacenum), read_or_write::READWRITE);
+	}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_sync - reinstall the watchpoint
+//  taps that no longer match their spans
+//-------------------------------------------------
+
+void device_debug::watchpoint_sync()
+{
+	m_flags &= ~DEBUG_FLAG_WATCH_TAPS;
+	for (int spacenum = 0; spacenum < int(m_wptaps.size()); spacenum++)
+		if (m_wptaps[spacenum].m_stale)
+		{
+			m_wptaps[spacenum].m_stale = false;
+			watchpoint_install(m_memory->space(spacenum), read_or_write::READWRITE);
+		}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_install - (re)install the taps for
+//  the watchpoints of an address space
+//-------------------------------------------------
+
+template <typename T>
+void device_debug::watchpoint_install_taps(address_space &space, read_or_write mode)
+{
+	int const spacenum = space.spacenum();
+	watchpoint_taps &taps = m_wptaps[spacenum];
+	if (u32(mode) & u32(read_or_write::READ))
+		for (auto const &range : taps.m_ranges[0])
+			taps.m_phr = space.install_read_tap(range.first, range.second, "watchpoints",
+												[this, spacenum](offs_t offset, T &data, T mem_mask) {
+													watchpoint_check(spacenum, read_or_write::READ, offset, data, mem_mask);
+												}, taps.m_phr);
+	if (u32(mode) & u32(read_or_write::WRITE))
+		for (auto const &range : taps.m_ranges[1])
+			taps.m_phw = space.install_write_tap(range.first, range.second, "watchpoints",
+												 [this, spacenum](offs_t offset, T &data, T mem_mask) {
+													 watchpoint_check(spacenum, read_or_write::WRITE, offset, data, mem_mask);
+												 }, taps.m_phw);
+}
+
+void device_debug::watchpoint_install(address_space &space, read_or_write mode)
+{
+	// installing a tap notifies every listener, including us
+	int const spacenum = space.spacenum();
+	if (m_wpinstalling || spacenum >= int(m_wptaps.size()))
+		return;
+	m_wpinstalling = true;
+
+	watchpoint_taps &taps = m_wptaps[spacenum];
+	if ((u32(mode) & u32(read_or_write::READ)) && taps.m_phr)
+		taps.m_phr->remove();
+	if ((u32(mode) & u32(read_or_write::WRITE)) && taps.m_phw)
+		taps.m_phw->remove();
+	switch (space.data_width())
+	{
+	case  8: watchpoint_install_taps<u8 >(space, mode); break;
+	case 16: watchpoint_install_taps<u16>(space, mode); break;
+	case 32: watchpoint_install_taps<u32>(space, mode); break;
+	case 64: watchpoint_install_taps<u64>(space, mode); break;
+	}
+	m_wpinstalling = false;
+}
+
+
 //-------------------------------------------------
 //  watchpoint_check - check the watchpoints
 //  for a given CPU and address space
 //-------------------------------------------------
 
+void device_debug::watchpoint_check(int spacenum, read_or_write type, offs_t address, u64 data, u64 mem_mask)
+{
+	running_machine &machine = m_device.machine();
+
+	// the debugger's own accesses never trigger
+	if (machine.debugger().cpu().within_instruction_hook() || machine.side_effects_disabled())
+		return;
+
+	// find the span holding the address
+	auto const &spans = m_wptaps[spacenum].m_spans[(type == read_or_write::WRITE) ? 1 : 0];
+	auto const span = std::lower_bound(spans.begin(), spans.end(), address,
+			[] (watchpoint_span const &s, offs_t a) { return s.m_end < a; });
+	if (span == spans.end() || span->m_start > address)
+		return;
+
+	// stop as soon as an action changes the watchpoints under us
+	m_wpdispatching = true;
+	for (auto const &point : span->m_points)
+	{
+		if (mem_mask & point.second)
+			point.first->triggered(type, address, data, mem_mask);
+		if (!m_wpcleared.empty() || std::any_of(m_wptaps.begin(), m_wptaps.end(), [] (watchpoint_taps const &t) { return t.m_dirty; }))
+			break;
+	}
+	m_wpdispatching = false;
+
+	m_wpcleared.clear();
+	for (int i = 0; i < int(m_wptaps.size()); i++)
+		if (m_wptaps[i].m_dirty)
+			watchpoint_update(i);
+}
+
+
 //-------------------------------------------------
 //  hotspot_check - check for hotspots on a
 //  memory read access
@@ -1796,6 +2171,231 @@ void device_debug::hotspot_check(address_space &space, offs_t address)
 
 
 
+//**************************************************************************
+//  MEMORY ACCESS HISTORY
+//**************************************************************************
+
+//-------------------------------------------------
+//  debug_memory_history - constructor
+//-------------------------------------------------
+
+debug_memory_history::debug_memory_history(running_machine &machine)
+	: m_machine(machine)
+	, m_entries()
+	, m_next(0)
+	, m_oldest(0)
+	, m_snapshots()
+{
+}
+
+
+//-------------------------------------------------
+//  ~debug_memory_history - destructor
+//-------------------------------------------------
+
+debug_memory_history::~debug_memory_history()
+{
+}
+
+
+//-------------------------------------------------
+//  enable - allocate the ring the first time
+//  something is recorded
+//-------------------------------------------------
+
+void debug_memory_history::enable()
+{
+	if (!m_entries)
+		m_entries = std::make_unique<access []>(ENTRIES);
+}
+
+
+//-------------------------------------------------
+//  record - append an access, overwriting the
+//  oldest one once the ring is full
+//-------------------------------------------------
+
+void debug_memory_history::record(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask)
+{
+	access &entry = m_entries[m_next++ & (ENTRIES - 1)];
+	device_t *const cpu = m_machine.debugger().cpu().live_cpu();
+	entry.m_cpu = cpu;
+	entry.m_space = &space;
+	entry.m_address = address;
+	entry.m_data = data;
+	entry.m_mem_mask = mem_mask;
+	entry.m_write = write;
+	if (cpu != nullptr)
+	{
+		device_debug const &debug = *cpu->debug();
+		entry.m_instruction = debug.instruction_count();
+		entry.m_cycles = debug.total_cycles();
+		entry.m_pc = debug.history_pc(0);
+	}
+	else
+	{
+		entry.m_instruction = entry.m_cycles = 0;
+		entry.m_pc = ~offs_t(0);
+	}
+}
+
+
+//-------------------------------------------------
+//  clear - forget everything recorded, after the
+//  machine state was replaced
+//-------------------------------------------------
+
+void debug_memory_history::clear()
+{
+	m_oldest = m_next;
+	m_snapshots.clear();
+}
+
+
+//-------------------------------------------------
+//  access::covers - work out which units an
+//  access touched and whether address is one
+//-------------------------------------------------
+
+bool debug_memory_history::access::covers(offs_t address, offs_t &start, u64 &data, int &size) const
+{
+	int const ashift = m_space->addr_shift();
+	offs_t const unit_size = ashift <= 0 ? 8 << -ashift : 8 >> ashift;
+	u64 const unit_mask = make_bitmask<u64>(unit_size);
+	u64 mask = m_mem_mask ? m_mem_mask : unit_mask;
+
+	offs_t offset = 0;
+	data = m_data;
+	while (!(mask & unit_mask))
+	{
+		offset++;
+		data >>= unit_size;
+		mask >>= unit_size;
+	}
+
+	size = 0;
+	while (mask)
+	{
+		size++;
+		mask >>= unit_size;
+	}
+	data &= make_bitmask<u64>(size * unit_size);
+
+	if (m_space->endianness() == ENDIANNESS_LITTLE)
+		start = m_address + offset;
+	else
+		start = m_address + m_space->alignment() - size - offset;
+	return address >= start && address < start + size;
+}
+
+
+//-------------------------------------------------
+//  find - return up to count recorded accesses
+//  touching an address, newest first
+//-------------------------------------------------
+
+std::vector<const debug_memory_history::access *> debug_memory_history::find(address_space &space, offs_t address, bool write, int count) const
+{
+	std::vector<const access *> result;
+	if (!m_entries)
+		return result;
+
+	u64 const oldest = std::max<u64>(m_oldest, (m_next > ENTRIES) ? (m_next - ENTRIES) : 0);
+	for (u64 pos = m_next; (pos > oldest) && (int(result.size()) < count); )
+	{
+		access const &entry = m_entries[--pos & (ENTRIES - 1)];
+		offs_t start;
+		u64 data;
+		int size;
+		if ((entry.m_space == &space) && (entry.m_write == write) && entry.covers(address, start, data, size))
+			result.push_back(&entry);
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  snapshot - save the machine state along with
+//  every CPU's instruction count
+//-------------------------------------------------
+
+bool debug_memory_history::snapshot()
+{
+	// reuse the oldest state's buffer once we have enough
+	std::unique_ptr<ram_state> state;
+	if (m_snapshots.size() == SNAPSHOTS)
+	{
+		state = std::move(m_snapshots.front().m_state);
+		m_snapshots.erase(m_snapshots.begin());
+	}
+	else
+	{
+		state = std::make_unique<ram_state>(m_machine.save());
+	}
+
+	if (state->save() != STATERR_NONE)
+	{
+		m_machine.debugger().console().printf("Unable to save the machine state; no more snapshots will be taken\n");
+		return false;
+	}
+
+	snapshot_entry entry;
+	entry.m_state = std::move(state);
+	entry.m_next = m_next;
+	for (device_execute_interface &exec : execute_interface_iterator(m_machine.root_device()))
+		if (exec.device().debug() != nullptr)
+			entry.m_counts.emplace_back(exec.device().debug(), exec.device().debug()->instruction_count());
+	m_snapshots.push_back(std::move(entry));
+	return true;
+}
+
+
+//-------------------------------------------------
+//  restore - load the newest snapshot taken at
+//  or before the target instruction of a CPU
+//-------------------------------------------------
+
+bool debug_memory_history::restore(device_debug &cpu, u64 target, u64 &restored)
+{
+	auto const snap = std::find_if(
+			m_snapshots.rbegin(),
+			m_snapshots.rend(),
+			[&cpu, target] (snapshot_entry const &entry)
+			{
+				for (auto const &count : entry.m_counts)
+					if (count.first == &cpu)
+						return count.second <= target;
+				return false;
+			});
+	if (snap == m_snapshots.rend())
+		return false;
+
+	if (snap->m_state->load() != STATERR_NONE)
+	{
+		m_machine.debugger().console().printf("Unable to restore the machine state\n");
+		return false;
+	}
+	for (auto const &count : snap->m_counts)
+	{
+		count.first->set_instruction_count(count.second);
+		if (count.first == &cpu)
+			restored = count.second;
+	}
+
+	// accesses recorded after the snapshot haven't happened yet, and the
+	// ones they overwrote are gone
+	if (m_next > ENTRIES)
+		m_oldest = std::max<u64>(m_oldest, m_next - ENTRIES);
+	m_next = snap->m_next;
+	m_oldest = std::min(m_oldest, m_next);
+
+	// later snapshots get retaken as execution runs forward again
+	m_snapshots.erase(snap.base(), m_snapshots.end());
+	return true;
+}
+
+
+
 //**************************************************************************
 //  TRACER
 //**************************************************************************
@@ -1804,7 +2404,7 @@ void device_debug::hotspot_check(address_space &space, offs_t address)
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, u8 binary_options)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
@@ -1814,8 +2414,42 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_skipping(false)
+	, m_binary(binary)
+	, m_binary_options(binary ? binary_options : 0)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	if (m_binary)
+	{
+		// registers are recorded in state entry order
+		if ((m_binary_options & util::trace_format::OPTION_REGISTERS) && m_debug.m_state != nullptr)
+			for (auto &entry : m_debug.m_state->state_entries())
+				if (entry->visible() && !entry->divider())
+					m_registers.push_back(entry.get());
+
+		// tap every address space for memory accesses
+		if ((m_binary_options & util::trace_format::OPTION_MEMORY) && m_debug.m_memory != nullptr)
+		{
+			m_taps.resize(m_debug.m_memory->max_space_count());
+			for (int spacenum = 0; spacenum < m_taps.size(); spacenum++)
+			{
+				space_taps &taps = m_taps[spacenum];
+				taps.m_space = m_debug.m_memory->has_space(spacenum) ? &m_debug.m_memory->space(spacenum) : nullptr;
+				taps.m_read = taps.m_write = nullptr;
+				taps.m_notifier = -1;
+				taps.m_installing = false;
+				if (taps.m_space != nullptr)
+				{
+					install_taps(spacenum, read_or_write::READWRITE);
+					taps.m_notifier = taps.m_space->add_change_notifier([this, spacenum] (read_or_write mode) { install_taps(spacenum, mode); });
+				}
+			}
+		}
+
+		m_block.reserve(util::trace_format::BLOCK_SIZE + 0x1000);
+		write_header();
+	}
 }
 
 
@@ -1825,6 +2459,21 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 
 device_debug::tracer::~tracer()
 {
+	// remove the memory taps
+	for (space_taps &taps : m_taps)
+		if (taps.m_space != nullptr)
+		{
+			taps.m_space->remove_change_notifier(taps.m_notifier);
+			if (taps.m_read != nullptr)
+				taps.m_read->remove();
+			if (taps.m_write != nullptr)
+				taps.m_write->remove();
+		}
+
+	// write out anything still buffered
+	if (m_binary)
+		write_block();
+
 	// make sure we close the file if we can
 	fclose(&m_file);
 }
@@ -1840,12 +2489,19 @@ void device_debug::tracer::update(offs_t pc)
 	// are we in trace over mode and in a subroutine?
 	if (m_trace_over && m_trace_over_target != ~0)
 	{
-		if (m_trace_over_target != pc)
+		m_skipping = m_trace_over_target != pc;
+		if (m_skipping)
 			return;
 		m_trace_over_target = ~0;
 	}
 
-	if (m_detect_loops)
+	// registers changed since the previous recorded instruction belong
+	// before this one, so a skipped subroutine shows up as a single record
+	if (!m_registers.empty())
+		record_registers();
+
+	// binary traces are compressed, so loops are kept as they are
+	if (m_detect_loops && !m_binary)
 	{
 		// check for a loop condition
 		int count = 0;
@@ -1871,13 +2527,22 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// record the opcode data only; unidasm turns it back into text
+		dasmresult = buffer.disassemble_info(pc);
+		record_instruction(pc, buffer, dasmresult);
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+		// output the result
+		fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -1895,7 +2560,8 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	fflush(&m_file);
+	if (!m_binary)
+		fflush(&m_file);
 }
 
 
@@ -1905,6 +2571,27 @@ void device_debug::tracer::update(offs_t pc)
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	if (m_binary)
+	{
+		// format into a text record
+		va_list vc;
+		va_copy(vc, va);
+		int const length = vsnprintf(nullptr, 0, format, vc);
+		va_end(vc);
+		if (length <= 0)
+			return;
+		std::vector<char> text(length + 1);
+		vsnprintf(&text[0], text.size(), format, va);
+
+		u16 const size = std::min(length, 0xffff);
+		put8(util::trace_format::TEXT);
+		put16(size);
+		m_block.insert(m_block.end(), text.begin(), text.begin() + size);
+		if (m_block.size() >= util::trace_format::BLOCK_SIZE)
+			write_block();
+		return;
+	}
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -1918,10 +2605,241 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
+	if (m_binary)
+		write_block();
 	fflush(&m_file);
 }
 
 
+//-------------------------------------------------
+//  write_header - write the chunk describing the
+//  traced device
+//-------------------------------------------------
+
+void device_debug::tracer::write_header()
+{
+	address_space *const program = (m_debug.m_memory != nullptr && m_debug.m_memory->has_space(AS_PROGRAM)) ? &m_debug.m_memory->space(AS_PROGRAM) : nullptr;
+
+	put8(util::trace_format::VERSION);
+	put8((program != nullptr) ? program->addr_shift() : 0);
+	put8((program != nullptr && program->endianness() == ENDIANNESS_BIG) ? 1 : 0);
+	put8(m_binary_options);
+	put32((program != nullptr) ? program->logaddrmask() : ~u32(0));
+	put8((m_debug.m_disasm != nullptr) ? m_debug.m_disasm->get_disassembler().opcode_alignment() : 1);
+	put_string(m_debug.m_device.tag());
+	put_string(m_debug.m_device.shortname());
+	put16(m_registers.size());
+	for (const device_state_entry *entry : m_registers)
+		put_string(entry->symbol());
+	put8(m_taps.size());
+	for (const space_taps &taps : m_taps)
+		put_string((taps.m_space != nullptr) ? taps.m_space->name() : "");
+
+	u8 const chunk[8] =
+	{
+		u8(util::trace_format::CHUNK_HEADER), u8(util::trace_format::CHUNK_HEADER >> 8), u8(util::trace_format::CHUNK_HEADER >> 16), u8(util::trace_format::CHUNK_HEADER >> 24),
+		u8(m_block.size()), u8(m_block.size() >> 8), u8(m_block.size() >> 16), u8(m_block.size() >> 24)
+	};
+	fwrite(chunk, 1, sizeof(chunk), &m_file);
+	fwrite(&m_block[0], 1, m_block.size(), &m_file);
+	m_block.clear();
+}
+
+
+//-------------------------------------------------
+//  write_block - compress the buffered records
+//  into a data chunk
+//-------------------------------------------------
+
+void device_debug::tracer::write_block()
+{
+	if (m_block.empty())
+		return;
+
+	uLongf compressed = compressBound(m_block.size());
+	m_compressed.resize(compressed + 12);
+	if (compress2(&m_compressed[12], &compressed, &m_block[0], m_block.size(), Z_BEST_SPEED) == Z_OK)
+	{
+		u32 const payload = compressed + 4;
+		u32 const uncompressed = m_block.size();
+		for (int i = 0; i < 4; i++)
+		{
+			m_compressed[i + 0] = u8(util::trace_format::CHUNK_DATA >> (8 * i));
+			m_compressed[i + 4] = u8(payload >> (8 * i));
+			m_compressed[i + 8] = u8(uncompressed >> (8 * i));
+		}
+		fwrite(&m_compressed[0], 1, compressed + 12, &m_file);
+	}
+	m_block.clear();
+}
+
+
+//-------------------------------------------------
+//  install_taps - (re)install the memory access
+//  taps for an address space
+//-------------------------------------------------
+
+void device_debug::tracer::install_taps(int spacenum, read_or_write mode)
+{
+	space_taps &taps = m_taps[spacenum];
+	if (taps.m_installing)
+		return;
+	taps.m_installing = true;
+
+	address_space &space = *taps.m_space;
+	bool const read = u32(mode) & u32(read_or_write::READ);
+	bool const write = u32(mode) & u32(read_or_write::WRITE);
+	if (read && taps.m_read != nullptr)
+		taps.m_read->remove();
+	if (write && taps.m_write != nullptr)
+		taps.m_write->remove();
+
+	std::string const name = util::string_format("trace@%s", m_debug.m_device.tag());
+	switch (space.data_width())
+	{
+	case 8:
+		if (read)
+			taps.m_read = space.install_read_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u8 &data, u8 mem_mask) { record_memory(util::trace_format::MEMORY_READ, spacenum, offset, data, mem_mask); }, taps.m_read);
+		if (write)
+			taps.m_write = space.install_write_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u8 &data, u8 mem_mask) { record_memory(util::trace_format::MEMORY_WRITE, spacenum, offset, data, mem_mask); }, taps.m_write);
+		break;
+
+	case 16:
+		if (read)
+			taps.m_read = space.install_read_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u16 &data, u16 mem_mask) { record_memory(util::trace_format::MEMORY_READ, spacenum, offset, data, mem_mask); }, taps.m_read);
+		if (write)
+			taps.m_write = space.install_write_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u16 &data, u16 mem_mask) { record_memory(util::trace_format::MEMORY_WRITE, spacenum, offset, data, mem_mask); }, taps.m_write);
+		break;
+
+	case 32:
+		if (read)
+			taps.m_read = space.install_read_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u32 &data, u32 mem_mask) { record_memory(util::trace_format::MEMORY_READ, spacenum, offset, data, mem_mask); }, taps.m_read);
+		if (write)
+			taps.m_write = space.install_write_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u32 &data, u32 mem_mask) { record_memory(util::trace_format::MEMORY_WRITE, spacenum, offset, data, mem_mask); }, taps.m_write);
+		break;
+
+	case 64:
+		if (read)
+			taps.m_read = space.install_read_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u64 &data, u64 mem_mask) { record_memory(util::trace_format::MEMORY_READ, spacenum, offset, data, mem_mask); }, taps.m_read);
+		if (write)
+			taps.m_write = space.install_write_tap(0, space.addrmask(), name,
+					[this, spacenum] (offs_t offset, u64 &data, u64 mem_mask) { record_memory(util::trace_format::MEMORY_WRITE, spacenum, offset, data, mem_mask); }, taps.m_write);
+		break;
+	}
+	taps.m_installing = false;
+}
+
+
+//-------------------------------------------------
+//  record_instruction - add the opcode data for
+//  the instruction at pc
+//-------------------------------------------------
+
+void device_debug::tracer::record_instruction(offs_t pc, const debug_disasm_buffer &buffer, u32 dasmresult)
+{
+	offs_t const length = dasmresult & util::disasm_interface::LENGTHMASK;
+
+	put8(util::trace_format::INSTRUCTION);
+	put32(pc);
+	for (bool opcode : { true, false })
+	{
+		buffer.data_get(pc, length, opcode, m_opdata);
+		u8 const size = std::min<size_t>(m_opdata.size(), 0xff);
+		put8(size);
+		m_block.insert(m_block.end(), m_opdata.begin(), m_opdata.begin() + size);
+	}
+
+	if (m_block.size() >= util::trace_format::BLOCK_SIZE)
+		write_block();
+}
+
+
+//-------------------------------------------------
+//  record_registers - add the registers that
+//  changed since the last instruction
+//-------------------------------------------------
+
+void device_debug::tracer::record_registers()
+{
+	// the first record holds every register
+	bool const all = m_register_values.empty();
+	if (all)
+		m_register_values.resize(m_registers.size());
+
+	size_t const start = m_block.size();
+	u16 count = 0;
+	for (int index = 0; index < m_registers.size(); index++)
+	{
+		u64 const value = m_registers[index]->value();
+		if (all || value != m_register_values[index])
+		{
+			if (count++ == 0)
+			{
+				put8(util::trace_format::REGISTERS);
+				put16(0);
+			}
+			put16(index);
+			put64(value);
+			m_register_values[index] = value;
+		}
+	}
+
+	// patch in the final count
+	if (count != 0)
+	{
+		m_block[start + 1] = u8(count);
+		m_block[start + 2] = u8(count >> 8);
+	}
+}
+
+
+//-------------------------------------------------
+//  record_memory - add a memory access made by
+//  the traced device
+//-------------------------------------------------
+
+void device_debug::tracer::record_memory(u8 type, int spacenum, offs_t address, u64 data, u64 mem_mask)
+{
+	// ignore the debugger's own accesses and those made inside a subroutine
+	// that trace over is skipping
+	running_machine &machine = m_debug.m_device.machine();
+	if (m_skipping || machine.debugger().cpu().within_instruction_hook() || machine.side_effects_disabled())
+		return;
+
+	// the taps see the whole bus, so drop accesses made by other devices
+	device_execute_interface *const executing = machine.scheduler().currently_executing();
+	if (!executing || &executing->device() != &m_debug.m_device)
+		return;
+
+	put8(type);
+	put8(spacenum);
+	put32(address);
+	put64(data);
+	put64(mem_mask);
+	if (m_block.size() >= util::trace_format::BLOCK_SIZE)
+		write_block();
+}
+
+
+//-------------------------------------------------
+//  put_string - add a length prefixed string
+//-------------------------------------------------
+
+void device_debug::tracer::put_string(const char *string)
+{
+	size_t const length = std::min<size_t>(strlen(string), 0xff);
+	put8(length);
+	m_block.insert(m_block.end(), string, string + length);
+}
+
+
 //-------------------------------------------------
 //  dasm_pc_tag - constructor
 //-------------------------------------------------
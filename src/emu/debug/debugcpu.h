@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <array>
 #include <set>
 
 
@@ -148,8 +149,17 @@ public:
 												const u64& data) const;
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
+	// memory access history
+	u64 instruction_count() const { return m_instruction_count; }
+	u64 total_cycles() const { return m_total_cycles; }
+	void set_instruction_count(u64 count) { m_instruction_count = count; }
+	void memory_history_record(int spacenum, bool enable);
+	bool memory_history_recording(int spacenum) const { return BIT(m_memhist_spaces, spacenum); }
+	void memory_history_snapshots(u64 interval);
+	bool reverse_step(u64 numsteps = 1);
+
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary = false, u8 binary_options = 0);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -170,10 +180,18 @@ private:
 	// breakpoint and watchpoint helpers
 	void breakpoint_update_flags();
 	void breakpoint_check(offs_t pc);
+	static u32 breakpoint_hash(offs_t pc) { return u32(pc * 0x9e3779b1U) >> (32 - BP_FILTER_SHIFT); }
+	bool breakpoint_maybe(offs_t pc) const { const u32 h = breakpoint_hash(pc); return BIT(m_bpfilter[h >> 6], h & 63); }
+	void watchpoint_update(int spacenum);
+	void watchpoint_sync();
+	void watchpoint_install(address_space &space, read_or_write mode);
+	template <typename T> void watchpoint_install_taps(address_space &space, read_or_write mode);
+	void watchpoint_check(int spacenum, read_or_write type, offs_t address, u64 data, u64 mem_mask);
 	void hotspot_check(address_space &space, offs_t address);
 	void reinstall_all(read_or_write mode);
 	void reinstall(address_space &space, read_or_write mode);
 	void write_tracking(address_space &space, offs_t address, u64 data);
+	void memory_history_access(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask);
 
 	// basic device information
 	device_t &                 m_device;                // device we are attached to
@@ -201,6 +219,8 @@ private:
 	attotime                m_endexectime;              // ending time of the current execution
 	u64                     m_total_cycles;             // current total cycles
 	u64                     m_last_total_cycles;        // last total cycles
+	u64                     m_instruction_count;        // instructions started since the debugger attached
+	u64                     m_stopcount;                // stop instruction count for DEBUG_FLAG_STOP_COUNT
 
 	// history
 	offs_t                  m_pc_history[HISTORY_SIZE]; // history of recent PCs
@@ -211,6 +231,33 @@ private:
 	std::vector<std::vector<std::unique_ptr<debug_watchpoint>>> m_wplist;  // watchpoint lists for each address space
 	std::unique_ptr<std::forward_list<debug_registerpoint>> m_rplist;      // list of registerpoints
 
+	// hashed set of PCs with enabled breakpoints; a clear bit means no breakpoint there
+	static constexpr int BP_FILTER_SHIFT = 12;
+	std::array<u64, (1 << BP_FILTER_SHIFT) / 64> m_bpfilter;
+
+	// addresses watched by the same watchpoints
+	struct watchpoint_span
+	{
+		offs_t              m_start;                    // first address
+		offs_t              m_end;                      // last address
+		std::vector<std::pair<debug_watchpoint *, u64>> m_points; // watchpoints with their lane masks
+	};
+
+	// coalesced taps and lookup for the watchpoints of one address space
+	struct watchpoint_taps
+	{
+		std::vector<watchpoint_span> m_spans[2];        // read and write spans, sorted and disjoint
+		std::vector<std::pair<offs_t, offs_t>> m_ranges[2]; // tapped ranges, adjacent spans merged
+		memory_passthrough_handler *m_phr = nullptr;    // read taps
+		memory_passthrough_handler *m_phw = nullptr;    // write taps
+		bool                m_dirty = false;            // watchpoints changed while dispatching
+		bool                m_stale = false;            // ranges changed since the taps were installed
+	};
+	std::vector<watchpoint_taps> m_wptaps;              // watchpoint taps for each address space
+	std::vector<std::unique_ptr<debug_watchpoint>> m_wpcleared; // watchpoints cleared while dispatching
+	bool                    m_wpdispatching;            // watchpoint conditions and actions running
+	bool                    m_wpinstalling;             // watchpoint taps being installed
+
 	debug_breakpoint *      m_triggered_breakpoint;     // latest breakpoint that was triggered
 	debug_watchpoint *      m_triggered_watchpoint;     // latest watchpoint that was triggered
 
@@ -218,7 +265,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, u8 binary_options);
 		~tracer();
 
 		void update(offs_t pc);
@@ -229,6 +276,29 @@ private:
 	private:
 		static const int TRACE_LOOPS = 64;
 
+		// memory taps for one address space of a binary trace
+		struct space_taps
+		{
+			address_space *     m_space;                // space being tapped
+			memory_passthrough_handler *m_read;         // read tap
+			memory_passthrough_handler *m_write;        // write tap
+			int                 m_notifier;             // change notifier id
+			bool                m_installing;           // true while (re)installing
+		};
+
+		// binary trace helpers
+		void write_header();
+		void write_block();
+		void install_taps(int spacenum, read_or_write mode);
+		void record_instruction(offs_t pc, const debug_disasm_buffer &buffer, u32 dasmresult);
+		void record_registers();
+		void record_memory(u8 type, int spacenum, offs_t address, u64 data, u64 mem_mask);
+		void put8(u8 data) { m_block.push_back(data); }
+		void put16(u16 data) { put8(data); put8(data >> 8); }
+		void put32(u32 data) { put16(data); put16(data >> 16); }
+		void put64(u64 data) { put32(data); put32(data >> 32); }
+		void put_string(const char *string);
+
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
 		std::string         m_action;                   // action to perform during a trace
@@ -241,6 +311,15 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		bool                m_skipping;                 // true while tracing over a subroutine
+		bool                m_binary;                   // true if writing a binary trace
+		u8                  m_binary_options;           // util::trace_format::OPTION_* flags
+		std::vector<u8>     m_block;                    // uncompressed records not yet written
+		std::vector<u8>     m_compressed;               // compression buffer
+		std::vector<u8>     m_opdata;                   // opcode data scratch buffer
+		std::vector<const device_state_entry *> m_registers; // registers recorded in the trace
+		std::vector<u64>    m_register_values;          // last recorded register values
+		std::vector<space_taps> m_taps;                 // memory taps, one per address space
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -259,6 +338,11 @@ private:
 	std::vector<memory_passthrough_handler *> m_phw;    // passthrough handler reference for each space, write mode
 	std::vector<int>        m_notifiers;                // notifiers for each space
 
+	// memory access history
+	u32                     m_memhist_spaces;           // address spaces being recorded
+	u64                     m_snapshot_interval;        // instructions between snapshots, or 0
+	u64                     m_snapshot_at;              // instruction count of the next snapshot
+
 	// pc tracking
 	class dasm_pc_tag
 	{
@@ -337,14 +421,77 @@ private:
 	static constexpr u32 DEBUG_FLAG_SUSPENDED       = 0x00004000;       // CPU currently suspended
 	static constexpr u32 DEBUG_FLAG_LIVE_BP         = 0x00010000;       // there are live breakpoints for this CPU
 	static constexpr u32 DEBUG_FLAG_STOP_PRIVILEGE  = 0x00020000;       // run until execution level changes
+	static constexpr u32 DEBUG_FLAG_LIVE_RP         = 0x00040000;       // there are live registerpoints for this CPU
+	static constexpr u32 DEBUG_FLAG_WATCH_TAPS      = 0x00080000;       // watchpoint taps need reinstalling
+	static constexpr u32 DEBUG_FLAG_STOP_COUNT      = 0x00100000;       // there is a pending stop at an instruction count
 
 	static constexpr u32 DEBUG_FLAG_STEPPING_ANY    = DEBUG_FLAG_STEPPING | DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT;
 	static constexpr u32 DEBUG_FLAG_TRACING_ANY     = DEBUG_FLAG_TRACING | DEBUG_FLAG_TRACING_OVER;
 	static constexpr u32 DEBUG_FLAG_TRANSIENT       = DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC |
 			DEBUG_FLAG_STOP_INTERRUPT | DEBUG_FLAG_STOP_EXCEPTION | DEBUG_FLAG_STOP_VBLANK |
-			DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PRIVILEGE;
+			DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_PRIVILEGE | DEBUG_FLAG_STOP_COUNT;
+	static constexpr u32 DEBUG_FLAG_ARMED           = DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC |
+			DEBUG_FLAG_STOP_TIME | DEBUG_FLAG_STOP_COUNT | DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP | DEBUG_FLAG_WATCH_TAPS;
+};
+
+// ======================> debug_memory_history
+
+// bounded record of memory accesses, plus machine snapshots for stepping
+// backwards
+class debug_memory_history
+{
+public:
+	// one recorded access
+	struct access
+	{
+		u64                 m_instruction;              // instruction count of the accessing CPU
+		u64                 m_cycles;                   // total cycles of the accessing CPU
+		device_t *          m_cpu;                      // CPU executing at the time, if any
+		address_space *     m_space;                    // space accessed
+		offs_t              m_pc;                       // PC of the accessing instruction
+		offs_t              m_address;                  // bus address
+		u64                 m_data;                     // data read or written
+		u64                 m_mem_mask;                 // lanes accessed
+		bool                m_write;                    // write rather than read
+
+		bool covers(offs_t address, offs_t &start, u64 &data, int &size) const;
+	};
+
+	static constexpr size_t ENTRIES = 1 << 18;
+	static constexpr size_t SNAPSHOTS = 8;
+
+	debug_memory_history(running_machine &machine);
+	~debug_memory_history();
+
+	// recording
+	bool enabled() const { return bool(m_entries); }
+	void enable();
+	void record(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask);
+	void clear();
+
+	// queries, newest first
+	std::vector<const access *> find(address_space &space, offs_t address, bool write, int count) const;
+
+	// snapshots
+	bool snapshot();
+	bool restore(device_debug &cpu, u64 target, u64 &restored);
+
+private:
+	struct snapshot_entry
+	{
+		std::unique_ptr<ram_state> m_state;             // machine state
+		u64                 m_next;                     // history position when taken
+		std::vector<std::pair<device_debug *, u64>> m_counts; // instruction counts of all CPUs
+	};
+
+	running_machine &       m_machine;
+	std::unique_ptr<access []> m_entries;               // ring of accesses
+	u64                     m_next;                     // position of the next access
+	u64                     m_oldest;                   // oldest position still valid
+	std::vector<snapshot_entry> m_snapshots;            // snapshots, oldest first
 };
 
+
 //**************************************************************************
 //  CPU DEBUGGING
 //**************************************************************************
@@ -410,6 +557,7 @@ public:
 	void halt_on_next_instruction(device_t *device, util::format_argument_pack<std::ostream> &&args);
 	void ensure_comments_loaded();
 	void reset_transient_flags();
+	debug_memory_history &memory_history() { return *m_memory_history; }
 
 private:
 	static const size_t NUM_TEMP_VARIABLES;
@@ -442,6 +590,8 @@ private:
 	osd_ticks_t m_last_periodic_update_time;
 
 	bool        m_comments_loaded;
+
+	std::unique_ptr<debug_memory_history> m_memory_history;
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCPU_H
@@ -95,6 +95,8 @@ static const help_item static_help_list[] =
 		"  pcatmemd <address>[,<CPU>] -- query which PC wrote to a given data memory address for the current CPU\n"
 		"  pcatmemi <address>[,<CPU>] -- query which PC wrote to a given I/O memory address for the current CPU\n"
 		"                                (Note: you can also query this info by right clicking in a memory window\n"
+		"  memhist[{d|i|o}] [<bool>[,<CPU>[,<interval>]]] -- record memory accesses and take snapshots for backstep\n"
+		"  lastwrite[{d|i|o}] <address>[,<CPU>[,<count>]] -- list the most recent recorded writes to an address\n"
 		"  rewind[rw] -- go back in time by loading the most recent rewind state"
 		"  statesave[ss] <filename> -- save a state file for the current driver\n"
 		"  stateload[sl] <filename> -- load a state file for the current driver\n"
@@ -136,6 +138,7 @@ static const help_item static_help_list[] =
 		"  s[tep] [<count>=1] -- single steps for <count> instructions (F11)\n"
 		"  o[ver] [<count>=1] -- single steps over <count> instructions (F10)\n"
 		"  out -- single steps until the current subroutine/exception handler is exited (Shift-F11)\n"
+		"  b[ack]s[tep] [<count>=1] -- steps back <count> instructions using memhist snapshots\n"
 		"  g[o] [<address>] -- resumes execution, sets temp breakpoint at <address> (F5)\n"
 		"  ge[x] [<exception>[,<condition>]] -- resumes execution, setting temp breakpoint if <exception> is raised\n"
 		"  gi[nt] [<irqline>] -- resumes execution, setting temp breakpoint if <irqline> is taken (F7)\n"
@@ -465,6 +468,50 @@ static const help_item static_help_list[] =
 		"pcatmem 400000\n"
 		"  Print which PC wrote this CPU's memory location 0x400000.\n"
 	},
+	{
+		"memhist",
+		"\n"
+		"  memhist[{d|i|o}] [<bool>[,<CPU>[,<interval>]]]\n"
+		"\n"
+		"The memhist command records every read and write to an address space of a CPU in a ring "
+		"holding the most recent 262144 accesses, along with the CPU that was running, its PC, its "
+		"instruction count and its cycle count.  memhist and memhistp record the program space, "
+		"memhistd the data space, memhisti the I/O space and memhisto the opcodes space.  The first argument turns "
+		"recording on or off.  The second argument is a CPU selector; if no CPU is specified, the "
+		"current CPU is automatically selected.  While the CPU is recording, the machine state is also "
+		"saved every <interval> instructions of that CPU (1000000 by default, 0 for never), keeping the "
+		"last 8 snapshots, for the backstep command.  Only one CPU takes snapshots at a time.  Use "
+		"lastwrite to search the recorded accesses.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memhist\n"
+		"  Record the accesses to the current CPU's program space.\n"
+		"\n"
+		"memhistp 1,audiocpu,200000\n"
+		"  Record the accesses to the audiocpu program space, with a snapshot every 200000 instructions.\n"
+		"\n"
+		"memhistp 0\n"
+		"  Stop recording the current CPU's program space.\n"
+	},
+	{
+		"lastwrite",
+		"\n"
+		"  lastwrite[{d|i|o}] <address>[,<CPU>[,<count>]]\n"
+		"\n"
+		"The lastwrite command lists the most recent writes to <address> recorded by memhist, newest "
+		"first, with the CPU and PC that made each one.  The second argument is a CPU selector; if no "
+		"CPU is specified, the current CPU is automatically selected.  The third argument is the number "
+		"of writes to list, 1 by default.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"lastwrite c000\n"
+		"  Show which instruction last wrote to program address c000 of the current CPU.\n"
+		"\n"
+		"lastwrited 20,,10\n"
+		"  Show the last ten writes to data address 20 of the current CPU.\n"
+	},
 	{
 		"rewind[rw]",
 		"\n"
@@ -704,6 +751,25 @@ static const help_item static_help_list[] =
 		"step 4\n"
 		"  Steps forward four instructions on the current CPU.\n"
 	},
+	{
+		"backstep",
+		"\n"
+		"  b[ack]s[tep] [<count>=1]\n"
+		"\n"
+		"The backstep command goes back one or more instructions on the current CPU.  It restores the "
+		"newest memhist snapshot taken before the target instruction, then runs forward until the CPU "
+		"reaches it.  Replaying needs the same inputs as the original run to arrive at the same state, "
+		"and breakpoints and watchpoints hit on the way stop as usual.  Accesses recorded after the "
+		"restored snapshot are discarded, since they will be recorded again.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"bs\n"
+		"  Steps back one instruction on the current CPU.\n"
+		"\n"
+		"backstep 1000\n"
+		"  Steps back a thousand instructions on the current CPU.\n"
+	},
 	{
 		"over",
 		"\n"
@@ -876,7 +942,7 @@ static const help_item static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror|binary|regs|mem][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>. If <CPU> is omitted, "
 		"the currently active CPU is specified. When enabling tracing, specify the filename in the "
@@ -891,6 +957,12 @@ static const help_item static_help_list[] =
 		"to prevent commas and semicolons from being interpreted as applying to the trace command "
 		"itself.\n"
 		"\n"
+		"If 'binary' is specified, the trace is written as compressed binary records holding the PC "
+		"and opcode bytes of every instruction, which is much faster than disassembling as the game "
+		"runs. 'regs' adds the registers changed by each instruction and 'mem' adds the memory "
+		"accesses made by the CPU; both imply 'binary'. Loop detection does not apply to binary "
+		"traces. Use 'unidasm <filename> -trace -arch <architecture>' to disassemble them.\n"
+		"\n"
 		"Examples:\n"
 		"\n"
 		"trace joust.tr\n"
@@ -911,6 +983,9 @@ static const help_item static_help_list[] =
 		"trace >>pigskin.tr\n"
 		"  Begin tracing the currently active CPU, appending log output to pigskin.tr.\n"
 		"\n"
+		"trace galaga.trb,0,regs|mem\n"
+		"  Begin a binary trace of CPU #0 to galaga.trb, including register changes and memory accesses.\n"
+		"\n"
 		"trace off,0\n"
 		"  Turn off tracing on CPU #0.\n"
 		"\n"
@@ -169,8 +169,9 @@ void debug_view_breakpoints::view_click(const int button, const debug_view_xy& p
 		if ((bpIndex >= m_buffer.size()) || (bpIndex < 0))
 			return;
 
-		// Enable / disable
-		const_cast<debug_breakpoint &>(*m_buffer[bpIndex]).setEnabled(!m_buffer[bpIndex]->enabled());
+		// Enable / disable; go through the device so its breakpoint filter is updated
+		const debug_breakpoint &bp = *m_buffer[bpIndex];
+		const_cast<device_debug &>(*bp.debugInterface()).breakpoint_enable(bp.index(), !bp.enabled());
 
 		machine().debug_view().update_all(DVT_DISASSEMBLY);
 	}
@@ -190,8 +190,9 @@ void debug_view_watchpoints::view_click(const int button, const debug_view_xy& p
 		if ((wpIndex >= m_buffer.size()) || (wpIndex < 0))
 			return;
 
-		// Enable / disable
-		m_buffer[wpIndex]->setEnabled(!m_buffer[wpIndex]->enabled());
+		// Enable / disable; go through the device so its taps are updated
+		debug_watchpoint &wp = *m_buffer[wpIndex];
+		const_cast<device_debug &>(*wp.debugInterface()).watchpoint_enable(wp.index(), !wp.enabled());
 	}
 
 	begin_update();
@@ -116,11 +116,17 @@ public:
 	virtual u64 value() const override;
 	virtual void set_value(u64 newvalue) override;
 
+	// direct access for compiled expressions
+	const u64 *value_pointer() const { return m_ptr; }
+	bool is_constant() const { return m_constant; }
+
 private:
 	// internal state
 	symbol_table::getter_func   m_getter;
 	symbol_table::setter_func   m_setter;
 	u64                         m_value;
+	const u64 *                 m_ptr;              // storage behind the getter, if any
+	bool                        m_constant;         // value never changes
 };
 
 
@@ -237,7 +243,9 @@ integer_symbol_entry::integer_symbol_entry(symbol_table &table, const char *name
 				: ptr
 				? symbol_table::setter_func([ptr] (u64 value) { *ptr = value; })
 				: symbol_table::setter_func([this] (u64 value) { m_value = value; })),
-		m_value(0)
+		m_value(0),
+		m_ptr(ptr ? ptr : &m_value),
+		m_constant(false)
 {
 }
 
@@ -246,7 +254,9 @@ integer_symbol_entry::integer_symbol_entry(symbol_table &table, const char *name
 	: symbol_entry(table, SMT_INTEGER, name, ""),
 		m_getter([this] () { return m_value; }),
 		m_setter(nullptr),
-		m_value(constval)
+		m_value(constval),
+		m_ptr(&m_value),
+		m_constant(true)
 {
 }
 
@@ -255,7 +265,9 @@ integer_symbol_entry::integer_symbol_entry(symbol_table &table, const char *name
 	: symbol_entry(table, SMT_INTEGER, name, format),
 		m_getter(std::move(getter)),
 		m_setter(std::move(setter)),
-		m_value(0)
+		m_value(0),
+		m_ptr(nullptr),
+		m_constant(false)
 {
 }
 
@@ -1058,6 +1070,7 @@ expression_error::error_code symbol_table::memory_valid(const char *name, expres
 parsed_expression::parsed_expression(symbol_table &symtable, const char *expression, int default_base)
 	: m_symtable(symtable)
 	, m_default_base(default_base)
+	, m_compiled_root(0)
 {
 	assert(default_base == 8 || default_base == 10 || default_base == 16);
 
@@ -1075,9 +1088,14 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 	: m_symtable(src.m_symtable)
 	, m_default_base(src.m_default_base)
 	, m_original_string(src.m_original_string)
+	, m_compiled_root(0)
 {
 	if (!m_original_string.empty())
+	{
 		parse_string_into_tokens();
+		infix_to_postfix();
+		compile();
+	}
 }
 
 
@@ -1097,6 +1115,9 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// and build the tree used for execution
+	compile();
 }
 
 
@@ -1106,11 +1127,20 @@ void parsed_expression::parse(const char *expression)
 
 void parsed_expression::copy(const parsed_expression &src)
 {
+	if (&src == this)
+		return;
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
-	m_original_string.assign(src.m_original_string);
-	if (!m_original_string.empty())
-		parse_string_into_tokens();
+	if (!src.m_original_string.empty())
+		parse(src.m_original_string.c_str());
+	else
+	{
+		m_original_string.clear();
+		m_tokenlist.clear();
+		m_stringlist.clear();
+		m_compiled.clear();
+		m_compiled_params.clear();
+	}
 }
 
 
@@ -2304,3 +2334,457 @@ void parsed_expression::execute_function(parse_token &token)
 	result.configure_number(function->execute(paramcount, &funcparams[MAX_FUNCTION_PARAMS - paramcount]));
 	push_token(result);
 }
+
+
+
+//**************************************************************************
+//  COMPILED EXPRESSION
+//**************************************************************************
+
+//-------------------------------------------------
+//  apply_unary - evaluate a side effect free
+//  unary operator
+//-------------------------------------------------
+
+static inline u64 apply_unary(u8 optype, u64 value)
+{
+	switch (optype)
+	{
+		case TVL_COMPLEMENT:        return !value;
+		case TVL_NOT:               return ~value;
+		case TVL_UPLUS:             return value;
+		case TVL_UMINUS:            return -value;
+	}
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  apply_binary - evaluate a side effect free
+//  binary operator; the caller checks for a
+//  zero divisor
+//-------------------------------------------------
+
+static inline u64 apply_binary(u8 optype, u64 value1, u64 value2)
+{
+	switch (optype)
+	{
+		case TVL_MULTIPLY:          return value1 * value2;
+		case TVL_DIVIDE:            return value1 / value2;
+		case TVL_MODULO:            return value1 % value2;
+		case TVL_ADD:               return value1 + value2;
+		case TVL_SUBTRACT:          return value1 - value2;
+		case TVL_LSHIFT:            return value1 << value2;
+		case TVL_RSHIFT:            return value1 >> value2;
+		case TVL_LESS:              return value1 < value2;
+		case TVL_LESSOREQUAL:       return value1 <= value2;
+		case TVL_GREATER:           return value1 > value2;
+		case TVL_GREATEROREQUAL:    return value1 >= value2;
+		case TVL_EQUAL:             return value1 == value2;
+		case TVL_NOTEQUAL:          return value1 != value2;
+		case TVL_BAND:              return value1 & value2;
+		case TVL_BXOR:              return value1 ^ value2;
+		case TVL_BOR:               return value1 | value2;
+		case TVL_LAND:              return value1 && value2;
+		case TVL_LOR:               return value1 || value2;
+	}
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  is_division - true for operators that fail
+//  on a zero right hand side
+//-------------------------------------------------
+
+static inline bool is_division(u8 optype)
+{
+	return optype == TVL_DIVIDE || optype == TVL_MODULO;
+}
+
+
+//-------------------------------------------------
+//  compile - turn the postfix token list into a
+//  tree with resolved symbols and folded
+//  constants; anything execute_tokens rejects
+//  regardless of values is left to it
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	m_compiled.clear();
+	m_compiled_params.clear();
+
+	std::vector<u32> stack;
+	auto pop = [&stack] (const parse_token &token)
+	{
+		if (stack.empty())
+			throw expression_error(expression_error::STACK_UNDERFLOW, token.offset());
+		u32 const result = stack.back();
+		stack.pop_back();
+		return result;
+	};
+	auto pop_lval = [this, &pop] (const parse_token &token)
+	{
+		u32 const result = pop(token);
+		compiled_node const &node = m_compiled[result];
+		if ((node.type != compiled_node::SYMBOL || !node.symbol->is_lval()) && node.type != compiled_node::MEMORY)
+			throw expression_error(expression_error::NOT_LVAL, node.offset);
+		return result;
+	};
+
+	try
+	{
+		for (parse_token &token : m_tokenlist)
+		{
+			compiled_node node{};
+			node.offset = token.offset();
+
+			// numbers are constants
+			if (token.is_number())
+			{
+				node.type = compiled_node::CONSTANT;
+				node.value = token.value();
+			}
+
+			// symbols are read directly when they are backed by plain storage
+			else if (token.is_symbol())
+			{
+				symbol_entry *const symbol = token.symbol();
+				integer_symbol_entry *const integer = symbol->is_function() ? nullptr : downcast<integer_symbol_entry *>(symbol);
+				if (integer != nullptr && integer->is_constant())
+				{
+					node.type = compiled_node::CONSTANT;
+					node.value = integer->value();
+				}
+				else
+				{
+					node.type = compiled_node::SYMBOL;
+					node.symbol = symbol;
+					node.direct = (integer != nullptr) ? integer->value_pointer() : nullptr;
+				}
+			}
+
+			// strings never end up as an rval
+			else if (!token.is_operator())
+				throw expression_error(expression_error::NOT_RVAL, token.offset());
+
+			else switch (token.optype())
+			{
+				case TVL_PREINCREMENT:
+				case TVL_PREDECREMENT:
+				case TVL_POSTINCREMENT:
+				case TVL_POSTDECREMENT:
+					node.type = compiled_node::LVAL_UNARY;
+					node.optype = token.optype();
+					node.left = pop_lval(token);
+					node.offset = m_compiled[node.left].offset;
+					break;
+
+				case TVL_COMPLEMENT:
+				case TVL_NOT:
+				case TVL_UPLUS:
+				case TVL_UMINUS:
+					node.type = compiled_node::UNARY;
+					node.optype = token.optype();
+					node.left = pop(token);
+					node.offset = m_compiled[node.left].offset;
+					break;
+
+				case TVL_MULTIPLY:
+				case TVL_DIVIDE:
+				case TVL_MODULO:
+				case TVL_ADD:
+				case TVL_SUBTRACT:
+				case TVL_LSHIFT:
+				case TVL_RSHIFT:
+				case TVL_LESS:
+				case TVL_LESSOREQUAL:
+				case TVL_GREATER:
+				case TVL_GREATEROREQUAL:
+				case TVL_EQUAL:
+				case TVL_NOTEQUAL:
+				case TVL_BAND:
+				case TVL_BXOR:
+				case TVL_BOR:
+				case TVL_LAND:
+				case TVL_LOR:
+					node.type = compiled_node::BINARY;
+					node.optype = token.optype();
+					node.right = pop(token);
+					node.left = pop(token);
+					node.offset = std::min(m_compiled[node.left].offset, m_compiled[node.right].offset);
+					break;
+
+				case TVL_ASSIGN:
+				case TVL_ASSIGNMULTIPLY:
+				case TVL_ASSIGNDIVIDE:
+				case TVL_ASSIGNMODULO:
+				case TVL_ASSIGNADD:
+				case TVL_ASSIGNSUBTRACT:
+				case TVL_ASSIGNLSHIFT:
+				case TVL_ASSIGNRSHIFT:
+				case TVL_ASSIGNBAND:
+				case TVL_ASSIGNBXOR:
+				case TVL_ASSIGNBOR:
+				{
+					static const u8 s_operator[] =
+					{
+						TVL_ASSIGN, TVL_MULTIPLY, TVL_DIVIDE, TVL_MODULO, TVL_ADD, TVL_SUBTRACT,
+						TVL_LSHIFT, TVL_RSHIFT, TVL_BAND, TVL_BXOR, TVL_BOR
+					};
+					node.type = compiled_node::LVAL_BINARY;
+					node.optype = s_operator[token.optype() - TVL_ASSIGN];
+					node.right = pop(token);
+					node.left = pop_lval(token);
+					node.offset = (node.optype == TVL_ASSIGN)
+							? m_compiled[node.right].offset
+							: std::min(m_compiled[node.left].offset, m_compiled[node.right].offset);
+					break;
+				}
+
+				case TVL_COMMA:
+					if (token.is_function_separator())
+						continue;
+					node.type = compiled_node::COMMA;
+					node.right = pop(token);
+					node.left = pop(token);
+					node.offset = m_compiled[node.right].offset;
+					break;
+
+				case TVL_MEMORYAT:
+					node.type = compiled_node::MEMORY;
+					node.left = pop(token);
+					node.memspace = token.memory_space();
+					node.memsize = token.memory_size();
+					node.disable_se = token.memory_side_effects();
+					node.memname = token.memory_source();
+					break;
+
+				case TVL_EXECUTEFUNC:
+				{
+					// parameters are everything stacked above the function symbol
+					size_t paramcount = 0;
+					while (true)
+					{
+						if (paramcount == stack.size() || paramcount == MAX_FUNCTION_PARAMS)
+							throw expression_error(expression_error::INVALID_PARAM_COUNT, token.offset());
+						compiled_node const &peek = m_compiled[stack[stack.size() - 1 - paramcount]];
+						if (peek.type == compiled_node::SYMBOL && peek.symbol->is_function())
+							break;
+						paramcount++;
+					}
+
+					function_symbol_entry *const function = downcast<function_symbol_entry *>(m_compiled[stack[stack.size() - 1 - paramcount]].symbol);
+					if (paramcount < function->minparams())
+						throw expression_error(expression_error::TOO_FEW_PARAMS, token.offset(), function->minparams());
+					if (paramcount > function->maxparams())
+						throw expression_error(expression_error::TOO_MANY_PARAMS, token.offset(), function->maxparams());
+
+					node.type = compiled_node::FUNCTION;
+					node.symbol = function;
+					node.left = m_compiled_params.size();
+					node.right = paramcount;
+					m_compiled_params.insert(m_compiled_params.end(), stack.end() - paramcount, stack.end());
+					stack.resize(stack.size() - paramcount - 1);
+					break;
+				}
+
+				default:
+					throw expression_error(expression_error::SYNTAX, token.offset());
+			}
+
+			stack.push_back(compile_node(node));
+		}
+
+		// we must end up with exactly one result
+		if (stack.size() != 1)
+			throw expression_error(expression_error::SYNTAX, 0);
+		m_compiled_root = stack.back();
+	}
+	catch (expression_error &)
+	{
+		// let execute_tokens report it at execution time as before
+		m_compiled.clear();
+		m_compiled_params.clear();
+	}
+}
+
+
+//-------------------------------------------------
+//  compile_node - add a node to the compiled
+//  tree, folding operators on constants
+//-------------------------------------------------
+
+u32 parsed_expression::compile_node(const compiled_node &node)
+{
+	compiled_node folded = node;
+	if (node.type == compiled_node::UNARY)
+	{
+		compiled_node const &left = m_compiled[node.left];
+		if (left.type == compiled_node::CONSTANT)
+		{
+			folded.type = compiled_node::CONSTANT;
+			folded.value = apply_unary(node.optype, left.value);
+		}
+	}
+	else if (node.type == compiled_node::BINARY || node.type == compiled_node::COMMA)
+	{
+		compiled_node const &left = m_compiled[node.left];
+		compiled_node const &right = m_compiled[node.right];
+		if (left.type == compiled_node::CONSTANT && right.type == compiled_node::CONSTANT)
+		{
+			if (node.type == compiled_node::COMMA)
+			{
+				folded.type = compiled_node::CONSTANT;
+				folded.value = right.value;
+			}
+			else if (right.value != 0 || !is_division(node.optype))
+			{
+				folded.type = compiled_node::CONSTANT;
+				folded.value = apply_binary(node.optype, left.value, right.value);
+			}
+		}
+	}
+
+	m_compiled.push_back(folded);
+	return m_compiled.size() - 1;
+}
+
+
+//-------------------------------------------------
+//  compiled_prepare - evaluate a node up to the
+//  point where execute_tokens would push it;
+//  symbols and memory are read later by
+//  compiled_resolve so accesses happen in the
+//  same order
+//-------------------------------------------------
+
+u64 parsed_expression::compiled_prepare(const compiled_node &node)
+{
+	switch (node.type)
+	{
+		case compiled_node::CONSTANT:
+			return node.value;
+
+		case compiled_node::SYMBOL:
+			return 0;
+
+		case compiled_node::MEMORY:
+			return compiled_value(m_compiled[node.left]);
+
+		case compiled_node::UNARY:
+			return apply_unary(node.optype, compiled_value(m_compiled[node.left]));
+
+		case compiled_node::BINARY:
+		{
+			compiled_node const &left = m_compiled[node.left];
+			compiled_node const &right = m_compiled[node.right];
+			u64 const prepared = compiled_prepare(left);
+			u64 const value2 = compiled_value(right);
+			u64 const value1 = compiled_resolve(left, prepared);
+			if (value2 == 0 && is_division(node.optype))
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, right.offset);
+			return apply_binary(node.optype, value1, value2);
+		}
+
+		case compiled_node::LVAL_UNARY:
+		{
+			compiled_node const &target = m_compiled[node.left];
+			u64 const prepared = compiled_prepare(target);
+			u64 const value = compiled_resolve(target, prepared);
+			switch (node.optype)
+			{
+				case TVL_PREINCREMENT:
+					compiled_set_lval(target, prepared, value + 1);
+					return value + 1;
+
+				case TVL_PREDECREMENT:
+					compiled_set_lval(target, prepared, value - 1);
+					return value - 1;
+
+				case TVL_POSTINCREMENT:
+					compiled_set_lval(target, prepared, value + 1);
+					return value;
+
+				case TVL_POSTDECREMENT:
+					compiled_set_lval(target, prepared, value - 1);
+					return value;
+			}
+			return value;
+		}
+
+		case compiled_node::LVAL_BINARY:
+		{
+			compiled_node const &target = m_compiled[node.left];
+			compiled_node const &source = m_compiled[node.right];
+			u64 const prepared = compiled_prepare(target);
+			u64 result = compiled_value(source);
+			if (node.optype != TVL_ASSIGN)
+			{
+				if (result == 0 && is_division(node.optype))
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, source.offset);
+				result = apply_binary(node.optype, compiled_resolve(target, prepared), result);
+			}
+			compiled_set_lval(target, prepared, result);
+			return result;
+		}
+
+		case compiled_node::COMMA:
+		{
+			compiled_node const &left = m_compiled[node.left];
+			u64 const prepared = compiled_prepare(left);
+			u64 const result = compiled_value(m_compiled[node.right]);
+			compiled_resolve(left, prepared);
+			return result;
+		}
+
+		case compiled_node::FUNCTION:
+		{
+			// parameters are pushed in order but resolved from the last one
+			u64 funcparams[MAX_FUNCTION_PARAMS];
+			u32 const *const params = m_compiled_params.data() + node.left;
+			for (u32 index = 0; index < node.right; index++)
+				funcparams[index] = compiled_prepare(m_compiled[params[index]]);
+			for (u32 index = node.right; index-- > 0; )
+				funcparams[index] = compiled_resolve(m_compiled[params[index]], funcparams[index]);
+			return downcast<function_symbol_entry *>(node.symbol)->execute(node.right, funcparams);
+		}
+	}
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  compiled_resolve - read the value of a
+//  prepared symbol or memory node
+//-------------------------------------------------
+
+u64 parsed_expression::compiled_resolve(const compiled_node &node, u64 prepared)
+{
+	switch (node.type)
+	{
+		case compiled_node::SYMBOL:
+			return (node.direct != nullptr) ? *node.direct : node.symbol->value();
+
+		case compiled_node::MEMORY:
+			return m_symtable.get().memory_value(node.memname, node.memspace, u32(prepared), 1 << node.memsize, node.disable_se);
+
+		default:
+			return prepared;
+	}
+}
+
+
+//-------------------------------------------------
+//  compiled_set_lval - write the value of a
+//  prepared symbol or memory node
+//-------------------------------------------------
+
+void parsed_expression::compiled_set_lval(const compiled_node &node, u64 prepared, u64 value)
+{
+	if (node.type == compiled_node::SYMBOL)
+		node.symbol->set_value(value);
+	else if (node.type == compiled_node::MEMORY)
+		m_symtable.get().set_memory_value(node.memname, node.memspace, u32(prepared), 1 << node.memsize, value, node.disable_se);
+}
@@ -19,6 +19,7 @@
 #include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -242,7 +243,7 @@ public:
 
 	// execution
 	void parse(const char *string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_compiled.empty() ? execute_tokens() : execute_compiled(); }
 
 private:
 	// a single token
@@ -304,6 +305,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -338,6 +340,35 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a node of the compiled expression tree
+	struct compiled_node
+	{
+		enum node_type : u8
+		{
+			CONSTANT,                               // value
+			SYMBOL,                                 // symbol, direct
+			MEMORY,                                 // *[left] in memspace/memsize
+			UNARY,                                  // optype [left]
+			BINARY,                                 // [left] optype [right]
+			LVAL_UNARY,                             // ++/-- on lval [left]
+			LVAL_BINARY,                            // lval [left] optype= [right]
+			COMMA,                                  // [left], [right]
+			FUNCTION                                // symbol(params[left..left+right])
+		};
+
+		node_type           type;
+		u8                  optype;                 // TVL_* operator
+		u8                  memsize;                // log2 of memory access size
+		bool                disable_se;             // memory access without side effects
+		expression_space    memspace;               // memory access space
+		int                 offset;                 // offset within the string
+		u32                 left, right;            // child nodes
+		u64                 value;                  // constant value
+		const u64 *         direct;                 // symbol storage that can be read directly
+		symbol_entry *      symbol;                 // symbol pointer
+		const char *        memname;                // memory source name
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens(FILE *out);
@@ -360,6 +391,15 @@ private:
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
 
+	// compiled execution helpers
+	void compile();
+	u32 compile_node(const compiled_node &node);
+	u64 execute_compiled() { return compiled_value(m_compiled[m_compiled_root]); }
+	u64 compiled_prepare(const compiled_node &node);
+	u64 compiled_resolve(const compiled_node &node, u64 prepared);
+	u64 compiled_value(const compiled_node &node) { return compiled_resolve(node, compiled_prepare(node)); }
+	void compiled_set_lval(const compiled_node &node, u64 prepared, u64 value);
+
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
 
@@ -370,6 +410,9 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_node> m_compiled;              // compiled tree (empty if not compilable)
+	std::vector<u32>    m_compiled_params;              // function parameter nodes
+	u32                 m_compiled_root;                // root node of the compiled tree
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
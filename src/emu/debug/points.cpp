@@ -88,8 +88,6 @@ debug_watchpoint::debug_watchpoint(device_debug* debugInterface,
 										const char *condition,
 										const char *action)
 	: m_debugInterface(debugInterface),
-	  m_phr(nullptr),
-	  m_phw(nullptr),
 	  m_space(space),
 	  m_index(index),
 	  m_enabled(true),
@@ -97,8 +95,7 @@ debug_watchpoint::debug_watchpoint(device_debug* debugInterface,
 	  m_address(address & space.addrmask()),
 	  m_length(length),
 	  m_condition(symbols, (condition != nullptr) ? condition : "1"),
-	  m_action((action != nullptr) ? action : ""),
-	  m_installing(false)
+	  m_action((action != nullptr) ? action : "")
 {
 	std::fill(std::begin(m_start_address), std::end(m_start_address), 0);
 	std::fill(std::begin(m_end_address), std::end(m_end_address), 0);
@@ -168,130 +165,6 @@ debug_watchpoint::debug_watchpoint(device_debug* debugInterface,
 			m_masks[idx] = emask;
 		}
 	}
-
-	install(read_or_write::READWRITE);
-	m_notifier = m_space.add_change_notifier([this](read_or_write mode) {
-												 if (m_enabled)
-												 {
-													 install(mode);
-												 }
-											 });
-}
-
-debug_watchpoint::~debug_watchpoint()
-{
-	m_space.remove_change_notifier(m_notifier);
-	if (m_phr)
-		m_phr->remove();
-	if (m_phw)
-		m_phw->remove();
-}
-
-void debug_watchpoint::setEnabled(bool value)
-{
-	if (m_enabled != value)
-	{
-		m_enabled = value;
-		if (m_enabled)
-			install(read_or_write::READWRITE);
-		else
-		{
-			m_installing = true;
-			if(m_phr)
-				m_phr->remove();
-			if(m_phw)
-				m_phw->remove();
-			m_installing = false;
-		}
-	}
-}
-
-void debug_watchpoint::install(read_or_write mode)
-{
-	if (m_installing)
-		return;
-	m_installing = true;
-	if ((u32(mode) & u32(read_or_write::READ)) && m_phr)
-		m_phr->remove();
-	if ((u32(mode) & u32(read_or_write::WRITE)) && m_phw)
-		m_phw->remove();
-	std::string name = util::string_format("wp@%x", m_address);
-	switch (m_space.data_width())
-	{
-	case  8:
-		if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-			m_phr = m_space.install_read_tap(m_start_address[0], m_end_address[0], name,
-											 [this](offs_t offset, u8 &data, u8 mem_mask) {
-												 triggered(read_or_write::READ, offset, data, mem_mask);
-											 }, m_phr);
-		if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-			m_phw = m_space.install_write_tap(m_start_address[0], m_end_address[0], name,
-											  [this](offs_t offset, u8 &data, u8 mem_mask) {
-												  triggered(read_or_write::WRITE, offset, data, mem_mask);
-											  }, m_phw);
-		break;
-
-	case 16:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u16 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u16 &data, u16 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u16 &data, u16 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
-
-	case 32:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u32 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u32 &data, u32 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u32 &data, u32 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
-
-	case 64:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u64 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u64 &data, u64 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u64 &data, u64 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
-	}
-	m_installing = false;
 }
 
 void debug_watchpoint::triggered(read_or_write type, offs_t address, u64 data, u64 mem_mask)
@@ -78,7 +78,6 @@ public:
 					offs_t length,
 					const char *condition = nullptr,
 					const char *action = nullptr);
-	~debug_watchpoint();
 
 	// getters
 	const device_debug *debugInterface() const { return m_debugInterface; }
@@ -91,19 +90,13 @@ public:
 	const char *condition() const { return m_condition.original_string(); }
 	const std::string &action() const { return m_action; }
 
-	// setters
-	void setEnabled(bool value);
-
 	// internals
 	bool hit(int type, offs_t address, int size);
 
 private:
-	void install(read_or_write mode);
 	void triggered(read_or_write type, offs_t address, u64 data, u64 mem_mask);
 
 	device_debug * m_debugInterface;                 // the interface we were created from
-	memory_passthrough_handler *m_phr;               // passthrough handler reference, read access
-	memory_passthrough_handler *m_phw;               // passthrough handler reference, write access
 	address_space &      m_space;                    // address space
 	int                  m_index;                    // user reported index
 	bool                 m_enabled;                  // enabled?
@@ -112,12 +105,10 @@ private:
 	offs_t               m_length;                   // length of watch area
 	parsed_expression    m_condition;                // condition
 	std::string          m_action;                   // action
-	int                  m_notifier;                 // address map change notifier id
 
 	offs_t               m_start_address[3];         // the start addresses of the checks to install
 	offs_t               m_end_address[3];           // the end addresses
 	u64                  m_masks[3];                 // the access masks
-	bool                 m_installing;               // prevent recursive multiple installs
 };
 
 // ======================> debug_registerpoint
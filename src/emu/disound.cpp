@@ -9,6 +9,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "speaker.h"
 
 
@@ -25,7 +26,8 @@ device_sound_interface::device_sound_interface(const machine_config &mconfig, de
 	device_interface(device, "sound"),
 	m_outputs(0),
 	m_auto_allocated_inputs(0),
-	m_specified_inputs_mask(0)
+	m_specified_inputs_mask(0),
+	m_sound_log_enabled(false)
 {
 }
 
@@ -331,6 +333,12 @@ void device_sound_interface::interface_pre_start()
 
 void device_sound_interface::interface_post_start()
 {
+	// register logging is armed here, the file itself is only created once
+	// the device actually logs something
+	const char *const soundlog = device().machine().options().sound_log();
+	m_sound_log_enabled = soundlog && *soundlog;
+	m_sound_log_last = attotime::zero;
+
 	// iterate over all the sound devices
 	for (device_sound_interface &sound : sound_interface_iterator(device().machine().root_device()))
 	{
@@ -393,6 +401,113 @@ void device_sound_interface::sound_stream_update(sound_stream &stream, std::vect
 }
 
 
+//-------------------------------------------------
+//  interface_post_stop - flush and close the
+//  register log
+//-------------------------------------------------
+
+void device_sound_interface::interface_post_stop()
+{
+	if (m_sound_log_file)
+	{
+		sound_log_flush();
+		m_sound_log_file.reset();
+	}
+	m_sound_log_enabled = false;
+}
+
+
+//-------------------------------------------------
+//  interface_post_load - restart register log
+//  timestamps from the restored machine time
+//-------------------------------------------------
+
+void device_sound_interface::interface_post_load()
+{
+	m_sound_log_last = device().machine().time();
+}
+
+
+//-------------------------------------------------
+//  sound_log_record - append a register write to
+//  the log file named <prefix>_<tag>.srl
+//
+//  The file starts with the magic "SRL\x1a", a
+//  version byte, the device clock (u32 LE) and the
+//  NUL-terminated device shortname and tag. Each
+//  write follows as the nanoseconds since the
+//  previous write, the port byte, the offset and
+//  the data, with all numbers apart from the port
+//  stored as LEB128 varints.
+//
+//  This is a capture format only: nothing in the
+//  tree replays or renders these logs yet.
+//-------------------------------------------------
+
+void device_sound_interface::sound_log_record(offs_t offset, u32 data, u8 port)
+{
+	auto const put_varint = [this] (u64 value)
+	{
+		do
+		{
+			u8 const byte = value & 0x7f;
+			value >>= 7;
+			m_sound_log_buffer.push_back(byte | (value ? 0x80 : 0x00));
+		}
+		while (value);
+	};
+
+	if (!m_sound_log_file)
+	{
+		std::string filename = device().tag() + 1;
+		std::replace(filename.begin(), filename.end(), ':', '_');
+		filename = string_format("%s_%s.srl", device().machine().options().sound_log(), filename);
+		if (util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, m_sound_log_file) != osd_file::error::NONE)
+		{
+			osd_printf_error("Unable to create sound register log %s\n", filename);
+			m_sound_log_enabled = false;
+			return;
+		}
+
+		static u8 const magic[] = { 'S', 'R', 'L', 0x1a, 1 };
+		u32 const clock = device().clock();
+		m_sound_log_buffer.assign(std::begin(magic), std::end(magic));
+		for (int shift = 0; shift < 32; shift += 8)
+			m_sound_log_buffer.push_back(u8(clock >> shift));
+		for (char const *name : { device().shortname(), device().tag() })
+			m_sound_log_buffer.insert(m_sound_log_buffer.end(), name, name + strlen(name) + 1);
+	}
+
+	// writes are timestamped relative to the previous one; time never runs
+	// backwards in the log, even if it does in the machine
+	attotime const now = device().machine().time();
+	attotime const delta = (now > m_sound_log_last) ? (now - m_sound_log_last) : attotime::zero;
+	m_sound_log_last = now;
+	put_varint(u64(delta.seconds()) * 1'000'000'000 + delta.attoseconds() / ATTOSECONDS_PER_NANOSECOND);
+	m_sound_log_buffer.push_back(port);
+	put_varint(offset);
+	put_varint(data);
+
+	if (m_sound_log_buffer.size() >= 0x10000)
+		sound_log_flush();
+}
+
+
+//-------------------------------------------------
+//  sound_log_flush - write pending register log
+//  data to the file
+//-------------------------------------------------
+
+void device_sound_interface::sound_log_flush()
+{
+	if (!m_sound_log_buffer.empty())
+	{
+		m_sound_log_file->write(&m_sound_log_buffer[0], m_sound_log_buffer.size());
+		m_sound_log_buffer.clear();
+	}
+}
+
+
 
 //**************************************************************************
 //  SIMPLE DERIVED MIXER INTERFACE
@@ -104,12 +104,26 @@ protected:
 	virtual void interface_pre_start() override;
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
+	virtual void interface_post_stop() override;
+	virtual void interface_post_load() override;
+
+	// register write logging (enabled with -soundlog)
+	void sound_log_write(offs_t offset, u32 data, u8 port = 0) { if (m_sound_log_enabled) sound_log_record(offset, data, port); }
 
 	// internal state
 	std::vector<sound_route> m_route_list;      // list of sound routes
 	int             m_outputs;                  // number of outputs from this instance
 	int             m_auto_allocated_inputs;    // number of auto-allocated inputs targeting us
 	u32             m_specified_inputs_mask;    // mask of inputs explicitly specified (not counting auto-allocated)
+
+private:
+	void sound_log_record(offs_t offset, u32 data, u8 port);
+	void sound_log_flush();
+
+	bool            m_sound_log_enabled;        // true if register writes are being logged
+	util::core_file::ptr m_sound_log_file;      // register log file, opened on first write
+	std::vector<u8> m_sound_log_buffer;         // pending register log data
+	attotime        m_sound_log_last;           // time of the previous logged write
 };
 
 // iterator
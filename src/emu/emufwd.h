@@ -78,6 +78,9 @@ class configuration_manager;
 // declared in crsshair.h
 class crosshair_manager;
 
+// declared in debug/debugbuf.h
+class debug_disasm_buffer;
+
 // declared in debug/debugcmd.h
 class debugger_commands;
 
@@ -85,6 +88,7 @@ class debugger_commands;
 class debugger_console;
 
 // declared in debug/debugcpu.h
+class debug_memory_history;
 class debugger_cpu;
 class device_debug;
 
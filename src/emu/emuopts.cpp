@@ -72,6 +72,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_MNGWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
 	{ OPTION_WAVWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a WAV file of the current session" },
+	{ OPTION_SOUNDLOG,                                   nullptr,     OPTION_STRING,     "optional filename prefix for logging sound chip register writes" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     OPTION_STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      OPTION_STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "internal",  OPTION_STRING,     "specify snapshot/movie view or 'internal' to use internal pixel-aspect views" },
@@ -89,6 +90,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_POLY_TILE_BINNING,                          "0",         OPTION_BOOLEAN,    "bin 3D rasterizer work into screen bands rendered by whole-band worker threads" },
+	{ OPTION_POLY_PIPELINE,                              "0",         OPTION_BOOLEAN,    "let supported 3D rasterizers finish a frame while the next one is emulated (adds a frame of 3D latency)" },
+	{ OPTION_POLY_STATS,                                 "0",         OPTION_BOOLEAN,    "publish per-frame 3D rasterizer counters as outputs, for Lua scripts and output clients" },
+	{ OPTION_PSXGPU_THREAD,                              "0",         OPTION_BOOLEAN,    "draw PlayStation GPU commands on a worker thread while the CPU runs (same output)" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -139,6 +144,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_SPEAKER_REPORT,                             "0",         OPTION_INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
+	{ OPTION_ADAPTIVE_AUDIO,                             "0",         OPTION_BOOLEAN,    "resample the final mix to keep the host audio buffer at its target fill" },
 
 	// input options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE INPUT OPTIONS" },
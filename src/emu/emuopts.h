@@ -60,6 +60,7 @@
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
 #define OPTION_WAVWRITE             "wavwrite"
+#define OPTION_SOUNDLOG             "soundlog"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
@@ -76,6 +77,10 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_POLY_TILE_BINNING    "poly_tile_binning"
+#define OPTION_POLY_PIPELINE        "poly_pipeline"
+#define OPTION_POLY_STATS           "poly_stats"
+#define OPTION_PSXGPU_THREAD        "psxgpu_thread"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,6 +125,7 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
+#define OPTION_ADAPTIVE_AUDIO       "adaptive_audio"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -341,6 +347,7 @@ public:
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
+	const char *sound_log() const { return value(OPTION_SOUNDLOG); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
@@ -357,6 +364,10 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool poly_tile_binning() const { return bool_value(OPTION_POLY_TILE_BINNING); }
+	bool poly_pipeline() const { return bool_value(OPTION_POLY_PIPELINE); }
+	bool poly_stats() const { return bool_value(OPTION_POLY_STATS); }
+	bool psxgpu_thread() const { return bool_value(OPTION_PSXGPU_THREAD); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -401,6 +412,7 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
+	bool adaptive_audio() const { return bool_value(OPTION_ADAPTIVE_AUDIO); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
@@ -154,6 +154,7 @@ void real_profiler_state::update_text(running_machine &machine)
 		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
 		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
 		{ PROFILER_BLIT,             "OSD Blitting" },
+		{ PROFILER_RASTER_WAIT,      "Rasterizer Wait" },
 		{ PROFILER_SOUND,            "Sound Generation" },
 		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
 		{ PROFILER_INPUT,            "Input Processing" },
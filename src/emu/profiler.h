@@ -46,6 +46,7 @@ enum profile_type
 	PROFILER_TILEMAP_DRAW_ROZ,
 	PROFILER_TILEMAP_UPDATE,
 	PROFILER_BLIT,
+	PROFILER_RASTER_WAIT,       // waiting for poly_manager worker threads
 	PROFILER_SOUND,
 	PROFILER_TIMER_CALLBACK,
 	PROFILER_INPUT,             // input.cpp and inptport.cpp
@@ -756,7 +756,17 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 #endif
 
 			// if we have an extended callback, that's all we need
-			m_callback_ex(*this, m_input_view, m_output_view);
+			if (!m_device.machine().sound().profiling())
+				m_callback_ex(*this, m_input_view, m_output_view);
+			else
+			{
+				// inputs are already up to date, so this is the time of our own callback only
+				osd_ticks_t const starttime = osd_ticks();
+				m_callback_ex(*this, m_input_view, m_output_view);
+				m_profile_current.ticks += osd_ticks() - starttime;
+				m_profile_current.calls++;
+				m_profile_current.samples += samples;
+			}
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -824,6 +834,19 @@ void sound_stream::apply_sample_rate_changes(u32 updatenum, u32 downstream_rate)
 }
 
 
+//-------------------------------------------------
+//  profile_rollover - close out the profiling
+//  counters for the current sound update
+//-------------------------------------------------
+
+void sound_stream::profile_rollover()
+{
+	m_profile_last = m_profile_current;
+	m_profile_total += m_profile_current;
+	m_profile_current = sound_stream_profile();
+}
+
+
 //-------------------------------------------------
 //  print_graph_recursive - helper for debugging;
 //  prints info on this stream and then recursively
@@ -833,7 +856,10 @@ void sound_stream::apply_sample_rate_changes(u32 updatenum, u32 downstream_rate)
 #if (SOUND_DEBUG)
 void sound_stream::print_graph_recursive(int indent, int index)
 {
-	osd_printf_info("%*s%s Ch.%d @ %d\n", indent, "", name().c_str(), index + m_output_base, sample_rate());
+	if (m_device.machine().sound().profiling())
+		osd_printf_info("%*s%s Ch.%d @ %d (%d calls, %.3f ms)\n", indent, "", name().c_str(), index + m_output_base, sample_rate(), m_profile_total.calls, double(m_profile_total.ticks) * 1000.0 / double(osd_ticks_per_second()));
+	else
+		osd_printf_info("%*s%s Ch.%d @ %d\n", indent, "", name().c_str(), index + m_output_base, sample_rate());
 	for (int index = 0; index < m_input.size(); index++)
 		if (m_input[index].valid())
 		{
@@ -1085,10 +1111,16 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_rightmix(machine.sample_rate()),
 	m_compressor_scale(1.0),
 	m_compressor_counter(0),
+	m_adaptive_audio(machine.options().adaptive_audio()),
+	m_adaptive_adjust(0.0),
+	m_adaptive_integral(0.0),
+	m_lastmix_left(0),
+	m_lastmix_right(0),
 	m_muted(0),
 	m_nosound_mode(machine.osd().no_sound()),
 	m_attenuation(0),
 	m_unique_id(0),
+	m_profiling(machine.options().verbose()),
 	m_wavfile(nullptr),
 	m_first_reset(true)
 {
@@ -1112,6 +1144,7 @@ sound_manager::sound_manager(running_machine &machine) :
 	machine.add_notifier(MACHINE_NOTIFY_RESUME, machine_notify_delegate(&sound_manager::resume, this));
 	machine.add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&sound_manager::reset, this));
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::stop_recording, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::profile_report, this));
 
 	// register global states
 	machine.save().save_item(NAME(m_last_update));
@@ -1178,6 +1211,46 @@ void sound_manager::stop_recording()
 }
 
 
+//-------------------------------------------------
+//  profile_report - print the per-stream profile
+//  counters, most expensive first
+//-------------------------------------------------
+
+void sound_manager::profile_report()
+{
+	if (!m_profiling || !machine().options().verbose())
+		return;
+
+	std::vector<sound_stream *> streams;
+	osd_ticks_t totalticks = 0;
+	for_each_stream([&streams, &totalticks] (sound_stream &stream)
+	{
+		stream.profile_rollover();
+		if (stream.profile_total().calls != 0)
+		{
+			streams.push_back(&stream);
+			totalticks += stream.profile_total().ticks;
+		}
+	});
+	std::stable_sort(streams.begin(), streams.end(), [] (sound_stream const *a, sound_stream const *b) { return a->profile_total().ticks > b->profile_total().ticks; });
+
+	double const tps = double(osd_ticks_per_second());
+	osd_printf_verbose("Sound stream profile (%d streams, %.3f ms total):\n", int(streams.size()), double(totalticks) * 1000.0 / tps);
+	for (sound_stream *stream : streams)
+	{
+		sound_stream_profile const &prof = stream->profile_total();
+		osd_printf_verbose("%6.2f%% %10.3f ms %10d calls %12d samples %8.3f us/call  %s @ %d\n",
+				totalticks ? double(prof.ticks) * 100.0 / double(totalticks) : 0.0,
+				double(prof.ticks) * 1000.0 / tps,
+				prof.calls,
+				prof.samples,
+				double(prof.ticks) * 1000000.0 / tps / double(prof.calls),
+				stream->name(),
+				stream->sample_rate());
+	}
+}
+
+
 //-------------------------------------------------
 //  set_attenuation - set the global volume
 //-------------------------------------------------
@@ -1355,6 +1428,9 @@ void sound_manager::pause()
 void sound_manager::resume()
 {
 	mute(false, MUTE_REASON_PAUSE);
+
+	// the OSD buffer drained while paused; don't carry that into the correction
+	m_adaptive_adjust = m_adaptive_integral = 0.0;
 }
 
 
@@ -1460,6 +1536,33 @@ stream_buffer::sample_t sound_manager::adjust_toward_compressor_scale(stream_buf
 }
 
 
+//-------------------------------------------------
+//  adaptive_finalmix_step - nudge the final mix
+//  step so the OSD audio buffer stays near its
+//  target fill
+//-------------------------------------------------
+
+s64 sound_manager::adaptive_finalmix_step(s64 step)
+{
+	// nothing to correct against if the OSD can't report its buffer level
+	float level = machine().osd().audio_buffer_level();
+	if (level < 0 || m_nosound_mode)
+		return step;
+
+	// a fuller buffer than targeted means we need to produce fewer samples,
+	// i.e. step faster through the mix; the integral term absorbs steady
+	// drift such as a 59.18Hz game synced to a 60Hz display
+	double error = std::clamp(double(level) - 1.0, -1.0, 1.0);
+	m_adaptive_integral = std::clamp(m_adaptive_integral + error * 0.0002, -ADAPTIVE_MAX_ADJUST, ADAPTIVE_MAX_ADJUST);
+
+	// smooth the proportional part so buffer jitter doesn't turn into audible wobble
+	m_adaptive_adjust += (error * 0.005 - m_adaptive_adjust) * 0.1;
+
+	double adjust = std::clamp(m_adaptive_adjust + m_adaptive_integral, -ADAPTIVE_MAX_ADJUST, ADAPTIVE_MAX_ADJUST);
+	return s64(double(step) * (1.0 + adjust) + 0.5);
+}
+
+
 //-------------------------------------------------
 //  update - mix everything down to its final form
 //  and send it to the OSD layer
@@ -1539,16 +1642,29 @@ void sound_manager::update(void *ptr, int param)
 	stream_buffer::sample_t lprev = 0, rprev = 0;
 
 	// now downmix the final result
-	u32 finalmix_step = machine().video().speed_factor();
+	s64 finalmix_step = s64(machine().video().speed_factor()) * (FINALMIX_ONE / 1000);
+	if (m_adaptive_audio)
+		finalmix_step = adaptive_finalmix_step(finalmix_step);
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
-	int sample;
-	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+	s64 sample;
+	for (sample = m_finalmix_leftover; sample < s64(m_samples_this_update) * FINALMIX_ONE; sample += finalmix_step)
 	{
-		int sampindex = sample / 1000;
+		int sampindex = sample / FINALMIX_ONE;
+		stream_buffer::sample_t lsamp = m_leftmix[sampindex];
+		stream_buffer::sample_t rsamp = m_rightmix[sampindex];
+
+		// when resampling, interpolate from the previous sample (one sample of delay)
+		if (m_adaptive_audio)
+		{
+			stream_buffer::sample_t frac = stream_buffer::sample_t(sample % FINALMIX_ONE) * (1.0f / FINALMIX_ONE);
+			stream_buffer::sample_t lbase = sampindex ? m_leftmix[sampindex - 1] : m_lastmix_left;
+			stream_buffer::sample_t rbase = sampindex ? m_rightmix[sampindex - 1] : m_lastmix_right;
+			lsamp = lbase + (lsamp - lbase) * frac;
+			rsamp = rbase + (rsamp - rbase) * frac;
+		}
 
 		// ensure that changing the compression won't reverse direction to reduce "pops"
-		stream_buffer::sample_t lsamp = m_leftmix[sampindex];
 		if (lscale != m_compressor_scale && sample != m_finalmix_leftover)
 			lscale = adjust_toward_compressor_scale(lscale, lprev, lsamp);
 
@@ -1561,7 +1677,6 @@ void sound_manager::update(void *ptr, int param)
 		finalmix[finalmix_offset++] = s16(lsamp * 32767.0);
 
 		// ensure that changing the compression won't reverse direction to reduce "pops"
-		stream_buffer::sample_t rsamp = m_rightmix[sampindex];
 		if (rscale != m_compressor_scale && sample != m_finalmix_leftover)
 			rscale = adjust_toward_compressor_scale(rscale, rprev, rsamp);
 
@@ -1573,7 +1688,12 @@ void sound_manager::update(void *ptr, int param)
 			rsamp = -1.0;
 		finalmix[finalmix_offset++] = s16(rsamp * 32767.0);
 	}
-	m_finalmix_leftover = sample - m_samples_this_update * 1000;
+	m_finalmix_leftover = sample - s64(m_samples_this_update) * FINALMIX_ONE;
+	if (m_samples_this_update != 0)
+	{
+		m_lastmix_left = m_leftmix[m_samples_this_update - 1];
+		m_lastmix_right = m_rightmix[m_samples_this_update - 1];
+	}
 
 	// play the result
 	if (finalmix_offset > 0)
@@ -1590,6 +1710,10 @@ void sound_manager::update(void *ptr, int param)
 	for (auto &stream : m_orphan_stream_list)
 		stream.first->update();
 
+	// close out this update's profiling counters
+	if (m_profiling)
+		for_each_stream([] (sound_stream &stream) { stream.profile_rollover(); });
+
 	// remember the update time
 	m_last_update = endtime;
 	m_update_number++;
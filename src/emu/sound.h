@@ -600,6 +600,19 @@ enum sound_stream_flags : u32
 };
 
 
+// ======================> sound_stream_profile
+
+// per-stream profiling counters, collected when sound profiling is enabled
+struct sound_stream_profile
+{
+	u64 calls = 0;                                 // number of update callbacks
+	u64 samples = 0;                               // number of samples generated (per output)
+	osd_ticks_t ticks = 0;                         // time spent inside the callback itself
+
+	sound_stream_profile &operator+=(sound_stream_profile const &rhs) { calls += rhs.calls; samples += rhs.samples; ticks += rhs.ticks; return *this; }
+};
+
+
 // ======================> sound_stream
 
 class sound_stream
@@ -651,6 +664,10 @@ public:
 	// apply any pending sample rate changes; should only be called by the sound manager
 	void apply_sample_rate_changes(u32 updatenum, u32 downstream_rate);
 
+	// profiling counters: totals so far, and those of the last complete sound update
+	sound_stream_profile const &profile_total() const { return m_profile_total; }
+	sound_stream_profile const &profile_last() const { return m_profile_last; }
+
 #if (SOUND_DEBUG)
 	// print one level of the sound graph and recursively tell our inputs to do the same
 	void print_graph_recursive(int indent, int index);
@@ -679,6 +696,9 @@ private:
 	// return a view of 0 data covering the given time period
 	read_stream_view empty_view(attotime start, attotime end);
 
+	// close out the profiling counters for the current sound update
+	void profile_rollover();
+
 	// linking information
 	device_t &m_device;                            // owning device
 	sound_stream *m_next;                          // next stream in the chain
@@ -706,6 +726,11 @@ private:
 
 	// callback information
 	stream_update_delegate m_callback_ex;          // extended callback function
+
+	// profiling information
+	sound_stream_profile m_profile_current;        // counters for the sound update in progress
+	sound_stream_profile m_profile_last;           // counters for the last complete sound update
+	sound_stream_profile m_profile_total;          // counters since start
 };
 
 
@@ -749,6 +774,12 @@ class sound_manager
 	// stream updates
 	static const attotime STREAMS_UPDATE_ATTOTIME;
 
+	// final mix positions are kept in millionths of a sample
+	static constexpr s64 FINALMIX_ONE = 1000000;
+
+	// maximum resampling correction applied by the adaptive audio option
+	static constexpr double ADAPTIVE_MAX_ADJUST = 0.02;
+
 public:
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
@@ -763,6 +794,21 @@ public:
 	attotime last_update() const { return m_last_update; }
 	int sample_count() const { return m_samples_this_update; }
 	int unique_id() { return m_unique_id++; }
+	bool profiling() const { return m_profiling; }
+
+	// enable or disable collection of per-stream profiling counters
+	void set_profiling(bool enable) { m_profiling = enable; }
+
+	// call the given function for every stream, including internal resamplers
+	template <typename T> void for_each_stream(T &&func) const
+	{
+		for (auto &stream : m_stream_list)
+		{
+			func(*stream);
+			for (auto &resampler : stream->m_resampler_list)
+				func(*resampler);
+		}
+	}
 
 	// allocate a new stream with a new-style callback
 	sound_stream *stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_delegate callback, sound_stream_flags flags);
@@ -812,6 +858,12 @@ private:
 	// helper to adjust scale factor toward a goal
 	stream_buffer::sample_t adjust_toward_compressor_scale(stream_buffer::sample_t curscale, stream_buffer::sample_t prevsample, stream_buffer::sample_t rawsample);
 
+	// compute the final mix step, correcting toward the OSD buffer target if enabled
+	s64 adaptive_finalmix_step(s64 step);
+
+	// print the stream profile at exit
+	void profile_report();
+
 	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
 	void update(void *ptr = nullptr, s32 param = 0);
 
@@ -821,7 +873,7 @@ private:
 
 	u32 m_update_number;                  // current update index; used for sample rate updates
 	attotime m_last_update;               // time of the last update
-	u32 m_finalmix_leftover;              // leftover samples in the final mix
+	s64 m_finalmix_leftover;              // leftover samples in the final mix, in FINALMIX_ONE units
 	u32 m_samples_this_update;            // number of samples this update
 	std::vector<s16> m_finalmix;          // final mix, in 16-bit signed format
 	std::vector<stream_buffer::sample_t> m_leftmix; // left speaker mix, in native format
@@ -830,10 +882,17 @@ private:
 	stream_buffer::sample_t m_compressor_scale; // current compressor scale factor
 	int m_compressor_counter;             // compressor update counter for backoff
 
+	bool m_adaptive_audio;                // true if resampling toward the OSD buffer target
+	double m_adaptive_adjust;             // smoothed proportional rate correction
+	double m_adaptive_integral;           // accumulated rate correction for steady clock drift
+	stream_buffer::sample_t m_lastmix_left; // last left sample of the previous update
+	stream_buffer::sample_t m_lastmix_right; // last right sample of the previous update
+
 	u8 m_muted;                           // bitmask of muting reasons
 	bool m_nosound_mode;                  // true if we're in "nosound" mode
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
+	bool m_profiling;                     // true if collecting per-stream profiling counters
 	wav_file *m_wavfile;                  // WAV file for streaming
 
 	// streams data
@@ -2271,8 +2271,10 @@ void lua_engine::initialize()
  * sound:ui_mute(turn_off) - turns on/off UI sound
  * sound:system_mute() - turns on/off system sound
  * sound:samples() - get current audio buffer contents in binary form as string (updates 50 times per second)
+ * sound:stream_profile() - get per-stream profiling counters as a list of tables (needs sound.profiling)
  *
  * sound.attenuation - sound attenuation
+ * sound.profiling - collect per-stream profiling counters
  */
 
 	auto sound_type = sol().registry().create_simple_usertype<sound_manager>("new", sol::no_constructor);
@@ -2290,7 +2292,28 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		});
+	sound_type.set("stream_profile", [this](sound_manager &sm) {
+			sol::table result = sol().create_table();
+			double const tps = double(osd_ticks_per_second());
+			sm.for_each_stream([&result, tps, this] (sound_stream &stream) {
+					sound_stream_profile const &total = stream.profile_total();
+					sound_stream_profile const &last = stream.profile_last();
+					sol::table entry = sol().create_table();
+					entry["name"] = stream.name();
+					entry["device"] = stream.device().tag();
+					entry["sample_rate"] = stream.sample_rate();
+					entry["calls"] = total.calls;
+					entry["samples"] = total.samples;
+					entry["seconds"] = double(total.ticks) / tps;
+					entry["last_calls"] = last.calls;
+					entry["last_samples"] = last.samples;
+					entry["last_seconds"] = double(last.ticks) / tps;
+					result.add(entry);
+				});
+			return result;
+		});
 	sound_type.set("attenuation", sol::property(&sound_manager::attenuation, &sound_manager::set_attenuation));
+	sound_type.set("profiling", sol::property(&sound_manager::profiling, &sound_manager::set_profiling));
 	sol().registry().set_usertype("sound", sound_type);
 
 
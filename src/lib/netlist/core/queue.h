@@ -26,13 +26,17 @@
 namespace netlist
 {
 	namespace detail {
-		// Use timed_queue_heap to use stdc++ heap functions instead of linear processing.
-		// This slows down processing by about 35% on a Kaby Lake.
-		// template <class T, bool TS>
-		// using timed_queue = plib::timed_queue_heap<T, TS>;
-
+		// See NL_QUEUE_TYPE in nl_config.h
+#if (NL_QUEUE_TYPE == 1)
+		template <class T, bool TS>
+		using timed_queue = plib::timed_queue_heap<T, TS>;
+#elif (NL_QUEUE_TYPE == 2)
+		template <class T, bool TS>
+		using timed_queue = plib::timed_queue_calendar<T, TS>;
+#else
 		template <class T, bool TS>
 		using timed_queue = plib::timed_queue_linear<T, TS>;
+#endif
 
 		// -----------------------------------------------------------------------------
 		// queue_t
@@ -83,8 +87,8 @@ namespace netlist
 				m_qsize = this->size();
 				for (std::size_t i = 0; i < m_qsize; i++ )
 				{
-					m_times[i] =  this->listptr()[i].exec_time().as_raw();
-					m_net_ids[i] = m_get_id(this->listptr()[i].object());
+					m_times[i] =  (*this)[i].exec_time().as_raw();
+					m_net_ids[i] = m_get_id((*this)[i].object());
 				}
 			}
 			void on_post_load(plib::state_manager_t &manager) override
@@ -66,6 +66,20 @@
 #define NL_USE_QUEUE_STATS             (0)
 #endif
 
+/// \brief  Event queue implementation.
+///
+/// 0: timed_queue_linear, a sorted array
+/// 1: timed_queue_heap, using the standard library heap functions
+/// 2: timed_queue_calendar, buckets for the next few hundred ns
+///
+/// The heap is about 35% slower than the linear queue on a Kaby Lake.
+/// benchmarks/netlist_queue.cpp compares all of them.
+///
+
+#ifndef NL_QUEUE_TYPE
+#define NL_QUEUE_TYPE                  (0)
+#endif
+
 /// \brief  Compile in academic solvers
 ///
 /// Set to 0 to disable compiling the following solvers:
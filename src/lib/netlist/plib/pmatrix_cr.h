@@ -17,6 +17,7 @@
 #include "pmatrix2d.h"
 #include "pomp.h"
 #include "ptypes.h"
+#include "vector_ops.h"
 
 #include <algorithm>
 #include <array>
@@ -335,6 +336,79 @@ namespace plib
 			}
 		}
 
+		/// \brief Precompute the element updates of gaussian_elimination
+		///
+		/// Must be called once the matrix structure is final. Afterwards
+		/// gaussian_elimination_scheme() performs the same operations in the
+		/// same order without searching for matching columns.
+		///
+		void build_elimination_scheme()
+		{
+			const std::size_t iN = base_type::size();
+
+			m_ge_steps.clear();
+			m_ge_row_end.clear();
+			m_ge_src.clear();
+			m_ge_dst.clear();
+
+			for (std::size_t i = 0; i + 1 < iN; i++)
+			{
+				std::size_t nzbdp = 0;
+				const std::size_t pi = base_type::diag[i] + 1u;
+				const std::size_t piie = base_type::row_idx[i+1];
+
+				const auto *nz = base_type::m_nzbd[i];
+				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				{
+					std::size_t pj = base_type::row_idx[j];
+					std::size_t pje = base_type::row_idx[j+1];
+
+					while (base_type::col_idx[pj] < i)
+						pj++;
+
+					const auto pji = narrow_cast<index_type>(pj++);
+
+					for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
+					{
+						while (base_type::col_idx[pj] < base_type::col_idx[pii])
+							pj++;
+						if (base_type::col_idx[pj] == base_type::col_idx[pii])
+						{
+							m_ge_src.push_back(narrow_cast<index_type>(pii));
+							m_ge_dst.push_back(narrow_cast<index_type>(pj++));
+						}
+					}
+					m_ge_steps.push_back({j, pji, m_ge_src.size()});
+				}
+				m_ge_row_end.push_back(m_ge_steps.size());
+			}
+		}
+
+		template <typename V>
+		void gaussian_elimination_scheme(V & RHS)
+		{
+			auto &A = base_type::A;
+			const index_type *src = m_ge_src.data();
+			const index_type *dst = m_ge_dst.data();
+			std::size_t s = 0;
+			std::size_t k = 0;
+
+			for (std::size_t i = 0; i < m_ge_row_end.size(); i++)
+			{
+				const auto f = reciprocal(A[base_type::diag[i]]);
+				for (const std::size_t se = m_ge_row_end[i]; s < se; s++)
+				{
+					const auto &st = m_ge_steps[s];
+					const typename base_type::value_type f1 = - A[st.pji] * f;
+
+					plib::vec_add_mult_scalar_idx(st.end - k, &A[0], dst + k, src + k, f1);
+					k = st.end;
+
+					RHS[st.row] += f1 * RHS[i];
+				}
+			}
+		}
+
 		int get_parallel_level(std::size_t k) const
 		{
 			for (std::size_t i = 0; i <  m_ge_par.size(); i++)
@@ -478,6 +552,18 @@ namespace plib
 			//  printf("%d %d\n", (int) k, (int) m_ge_par[k].size());
 		}
 		std::vector<std::vector<std::size_t>> m_ge_par; // parallel execution support for Gauss
+
+		// elimination scheme, see build_elimination_scheme
+		struct ge_step
+		{
+			std::size_t row;    // row j being updated
+			index_type pji;     // position of A(j, i)
+			std::size_t end;    // end of updates in m_ge_src/m_ge_dst
+		};
+		std::vector<ge_step> m_ge_steps;
+		std::vector<std::size_t> m_ge_row_end;  // end of steps for each pivot row
+		std::vector<index_type> m_ge_src;
+		std::vector<index_type> m_ge_dst;
 	};
 
 	template<typename B>
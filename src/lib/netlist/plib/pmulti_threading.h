@@ -13,9 +13,12 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -83,6 +86,123 @@ namespace plib {
 		long m_count;
 	};
 
+	/// \brief Fixed set of worker threads for short parallel loops.
+	///
+	/// run() distributes the indices [0, count) over the workers and the
+	/// calling thread and returns once all of them have been processed.
+	/// Results must be written to per-index storage by the callee; the
+	/// caller then consumes them in index order, which keeps the outcome
+	/// independent of scheduling.
+	///
+	/// The loops this is meant for take microseconds, so idle workers spin
+	/// for a while before blocking on a condition variable.
+	///
+	class pworker_pool
+	{
+	public:
+		/// \param threads total number of threads including the caller
+		explicit pworker_pool(std::size_t threads)
+		{
+			for (std::size_t i = 1; i < threads; i++)
+				m_workers.emplace_back([this]() { worker_main(); });
+		}
+
+		pworker_pool(const pworker_pool &) = delete;
+		pworker_pool &operator=(const pworker_pool &) = delete;
+		pworker_pool(pworker_pool &&) = delete;
+		pworker_pool &operator=(pworker_pool &&) = delete;
+
+		~pworker_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop.store(true, std::memory_order_release);
+			}
+			m_cv.notify_all();
+			for (auto &t : m_workers)
+				t.join();
+		}
+
+		std::size_t threads() const noexcept { return m_workers.size() + 1; }
+
+		template <typename T>
+		void run(std::size_t count, T &what)
+		{
+			m_ctx = &what;
+			m_func = [](void *ctx, std::size_t i) { (*static_cast<T *>(ctx))(i); };
+			m_count = count;
+			m_next.store(0, std::memory_order_relaxed);
+			m_pending.store(m_workers.size(), std::memory_order_relaxed);
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_generation.fetch_add(1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+
+			work();
+			while (m_pending.load(std::memory_order_acquire) != 0)
+				std::this_thread::yield();
+
+			if (m_exception)
+				std::rethrow_exception(std::exchange(m_exception, nullptr));
+		}
+
+	private:
+		static constexpr unsigned spin_count = 4096;
+
+		void work() noexcept
+		{
+			for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count; i = m_next.fetch_add(1, std::memory_order_relaxed))
+			{
+				try
+				{
+					m_func(m_ctx, i);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (!m_exception)
+						m_exception = std::current_exception();
+				}
+			}
+		}
+
+		void worker_main()
+		{
+			std::size_t seen = 0;
+			for (;;)
+			{
+				unsigned spins = 0;
+				while (m_generation.load(std::memory_order_acquire) == seen && !m_stop.load(std::memory_order_acquire))
+				{
+					if (++spins < spin_count)
+						std::this_thread::yield();
+					else
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_cv.wait(lock, [this, seen]() { return m_generation.load(std::memory_order_acquire) != seen || m_stop.load(std::memory_order_acquire); });
+					}
+				}
+				if (m_stop.load(std::memory_order_acquire))
+					return;
+				seen = m_generation.load(std::memory_order_acquire);
+				work();
+				m_pending.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::atomic<std::size_t> m_generation = { 0 };
+		std::atomic<bool> m_stop = { false };
+		std::atomic<std::size_t> m_next = { 0 };
+		std::atomic<std::size_t> m_pending = { 0 };
+		void *m_ctx = nullptr;
+		void (*m_func)(void *, std::size_t) = nullptr;
+		std::size_t m_count = 0;
+		std::exception_ptr m_exception;
+	};
 
 } // namespace plib
 
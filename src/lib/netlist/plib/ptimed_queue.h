@@ -14,6 +14,7 @@
 #include "ptypes.h"
 
 #include <algorithm>
+#include <array>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -286,7 +287,7 @@ namespace plib {
 		// save state support & mame disasm
 
 		constexpr const T *listptr() const { return &m_list[0]; }
-		constexpr std::size_t size() const noexcept { return m_list.size(); }
+		constexpr std::size_t size() const noexcept { return narrow_cast<std::size_t>(m_end - &m_list[0]); }
 		constexpr const T & operator[](const std::size_t index) const { return m_list[ 0 + index]; }
 	private:
 		using mutex_type = pspin_mutex<TS>;
@@ -303,6 +304,312 @@ namespace plib {
 		pperfcount_t<true> m_prof_remove; // NOLINT
 	};
 
+	/// \brief Calendar queue for narrow time horizons
+	///
+	/// Entries due within the next 64 << SHIFT time units are kept in
+	/// short sorted buckets indexed by their time. Anything further away
+	/// goes to an overflow list which is drained into the buckets as time
+	/// advances. TTL netlists schedule almost everything a few gate delays
+	/// ahead, so a push only has to sort into one short bucket instead of
+	/// moving entries across the whole queue. A bit mask of occupied
+	/// buckets keeps skipping over empty time slots cheap.
+	///
+	/// Entries with equal time are returned in the same order as
+	/// timed_queue_linear returns them.
+	///
+	/// \tparam T queue entry, e.g. pqentry_t
+	/// \tparam TS use a threadsafe queue
+	/// \tparam SHIFT log2 of the bucket width in raw time units
+	///
+	template <class T, bool TS, unsigned SHIFT = 5>
+	class timed_queue_calendar
+	{
+	public:
+
+		explicit timed_queue_calendar(const std::size_t list_size)
+		: m_list_size(list_size)
+		, m_never(T::never())
+		{
+			for (auto &b : m_buckets)
+				b.reserve(16);
+			m_far.reserve(list_size);
+			clear();
+		}
+		~timed_queue_calendar() = default;
+
+		PCOPYASSIGNMOVE(timed_queue_calendar, delete)
+
+		std::size_t capacity() const noexcept { return m_list_size; }
+		bool empty() const noexcept { return m_used == 0 && m_far.empty(); }
+
+		template<bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			insert<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
+		template<bool KEEPSTAT>
+		void push(T && e) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			insert<KEEPSTAT>(std::move(e));
+		}
+
+		void pop() noexcept
+		{
+			if (m_used == 0)
+			{
+				m_far.pop_back();
+				return;
+			}
+			auto &b = m_buckets[m_cur];
+			b.pop_back();
+			if (b.empty())
+			{
+				m_used &= ~(std::uint64_t(1) << m_cur);
+				advance();
+			}
+		}
+
+		const T &top() const noexcept
+		{
+			if (m_used != 0)
+				return m_buckets[m_cur].back();
+			return m_far.empty() ? m_never : m_far.back();
+		}
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_remove.inc();
+			// search in the order entries would be popped
+			for (std::uint64_t used = rotr(m_used, m_cur); used != 0; used &= used - 1)
+			{
+				const std::size_t idx = (m_cur + lowest_bit(used)) & MASK;
+				auto &b = m_buckets[idx];
+				for (auto i = b.size(); i-- > 0; )
+				{
+					// == operator ignores time!
+					if (b[i] == elem)
+					{
+						b.erase(b.begin() + narrow_cast<std::ptrdiff_t>(i));
+						if (b.empty())
+						{
+							m_used &= ~(std::uint64_t(1) << idx);
+							if (idx == m_cur)
+								advance();
+						}
+						return;
+					}
+				}
+			}
+			for (auto i = m_far.size(); i-- > 0; )
+			{
+				if (m_far[i] == elem)
+				{
+					m_far.erase(m_far.begin() + narrow_cast<std::ptrdiff_t>(i));
+					return;
+				}
+			}
+		}
+
+		void clear() noexcept
+		{
+			lock_guard_type lck(m_lock);
+			for (auto &b : m_buckets)
+				b.clear();
+			m_far.clear();
+			m_used = 0;
+			m_cur = 0;
+			m_base = 0;
+		}
+
+		// save state support & mame disasm
+
+		std::size_t size() const noexcept
+		{
+			std::size_t n = m_far.size();
+			for (const auto &b : m_buckets)
+				n += b.size();
+			return n;
+		}
+
+		/// \brief Access entries in the same order as timed_queue_linear
+		///
+		/// Index 0 is the entry popped last, size() - 1 is top().
+		/// This walks the buckets and is only meant for save states and
+		/// the debugger.
+		const T & operator[](std::size_t index) const noexcept
+		{
+			if (index < m_far.size())
+				return m_far[index];
+			index -= m_far.size();
+			for (std::size_t n = BUCKETS; n-- > 0; )
+			{
+				const auto &b = m_buckets[(m_cur + n) & MASK];
+				if (index < b.size())
+					return b[index];
+				index -= b.size();
+			}
+			return m_never;
+		}
+
+	private:
+		using mutex_type       = pspin_mutex<TS>;
+		using lock_guard_type  = std::lock_guard<mutex_type>;
+		using raw_type         = std::decay_t<decltype(std::declval<T>().exec_time().as_raw())>;
+
+		static constexpr const std::size_t BUCKETS = 64;
+		static constexpr const std::size_t MASK = BUCKETS - 1;
+		static constexpr const raw_type WIDTH = raw_type(1) << SHIFT;
+		static constexpr const raw_type HORIZON = WIDTH * raw_type(BUCKETS);
+
+		static raw_type raw(const T &e) noexcept { return e.exec_time().as_raw(); }
+		static std::size_t bucket_of(raw_type t) noexcept { return narrow_cast<std::size_t>(t >> SHIFT) & MASK; }
+
+		static std::uint64_t rotr(std::uint64_t v, std::size_t n) noexcept
+		{
+			return n == 0 ? v : (v >> n) | (v << (BUCKETS - n));
+		}
+
+		// index of the lowest bit set, v must not be zero
+		static std::size_t lowest_bit(std::uint64_t v) noexcept
+		{
+			static constexpr const std::array<std::uint8_t, 64> debruijn = {
+				 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+				62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+				63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+				46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6 };
+			return debruijn[((v & (~v + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+		}
+
+		// Insert e into a bucket: on top of entries with equal time for new
+		// entries, below them for entries drained from the overflow list.
+		template <bool KEEPSTAT, bool ONTOP>
+		void sort_into(std::size_t idx, T &&e) noexcept
+		{
+			auto &b = m_buckets[idx];
+			b.push_back(std::move(e));
+			for (auto i = b.size() - 1; i > 0; --i)
+			{
+				if (ONTOP ? !(b[i-1] < b[i]) : !(b[i-1] <= b[i]))
+					break;
+				std::swap(b[i-1], b[i]);
+				if (KEEPSTAT)
+					m_prof_sortmove.inc();
+			}
+			m_used |= std::uint64_t(1) << idx;
+		}
+
+		// Move the window start back to the bucket holding t. Buckets
+		// falling off the end of the window are spilled to the overflow
+		// list. Their entries are later than anything left in the buckets
+		// and earlier than anything in the overflow list.
+		void move_back(raw_type t) noexcept
+		{
+			const raw_type base = t & ~(WIDTH - 1);
+			const raw_type slots = (m_base - base) >> SHIFT;
+			if (slots >= raw_type(BUCKETS))
+			{
+				for (std::size_t n = BUCKETS; n-- > 0; )
+					spill((m_cur + n) & MASK);
+			}
+			else
+			{
+				for (std::size_t n = 1; n <= narrow_cast<std::size_t>(slots); n++)
+					spill((m_cur - n) & MASK);
+			}
+			m_base = base;
+			m_cur = bucket_of(t);
+		}
+
+		void spill(std::size_t idx) noexcept
+		{
+			if (m_used & (std::uint64_t(1) << idx))
+			{
+				auto &b = m_buckets[idx];
+				m_far.insert(m_far.end(), b.begin(), b.end());
+				b.clear();
+				m_used &= ~(std::uint64_t(1) << idx);
+			}
+		}
+
+		template <bool KEEPSTAT>
+		void insert(T &&e) noexcept
+		{
+			const raw_type t = raw(e);
+			if (m_used == 0)
+			{
+				// restart the window at the earliest entry
+				const raw_type first = (!m_far.empty() && raw(m_far.back()) < t) ? raw(m_far.back()) : t;
+				m_base = first & ~(WIDTH - 1);
+				m_cur = bucket_of(first);
+				drain<KEEPSTAT>();
+			}
+			else if (t < m_base)
+				move_back(t);
+
+			if (t - m_base >= HORIZON)
+			{
+				m_far.push_back(std::move(e));
+				for (auto i = m_far.size() - 1; i > 0 && m_far[i-1] < m_far[i]; --i)
+				{
+					std::swap(m_far[i-1], m_far[i]);
+					if (KEEPSTAT)
+						m_prof_sortmove.inc();
+				}
+			}
+			else
+				sort_into<KEEPSTAT, true>(bucket_of(t), std::move(e));
+			if (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		template <bool KEEPSTAT>
+		void drain() noexcept
+		{
+			while (!m_far.empty() && raw(m_far.back()) - m_base < HORIZON)
+			{
+				sort_into<KEEPSTAT, false>(bucket_of(raw(m_far.back())), std::move(m_far.back()));
+				m_far.pop_back();
+			}
+		}
+
+		// Move m_cur to the bucket holding the earliest entry. If the
+		// buckets are empty the window stays where it is and top() comes
+		// from the overflow list until the next push.
+		void advance() noexcept
+		{
+			if (m_used == 0)
+				return;
+			const std::size_t n = lowest_bit(rotr(m_used, m_cur));
+			m_cur = (m_cur + n) & MASK;
+			m_base += raw_type(n) * WIDTH;
+			drain<false>();
+		}
+
+		mutex_type                              m_lock;
+		std::size_t                             m_list_size;
+		std::uint64_t                           m_used;  // bit mask of non-empty buckets
+		std::size_t                             m_cur;
+		raw_type                                m_base;
+		T                                       m_never;
+		std::array<aligned_vector<T>, BUCKETS>  m_buckets;
+		aligned_vector<T>                       m_far;   // sorted like timed_queue_linear
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sortmove; // NOLINT
+		pperfcount_t<true> m_prof_call; // NOLINT
+		pperfcount_t<true> m_prof_remove; // NOLINT
+	};
+
 } // namespace plib
 
 #endif // PTIMED_QUEUE_H_
@@ -110,6 +110,17 @@ namespace plib
 			result[i] += scalar * v[i];
 	}
 
+	/// \brief v[dst[i]] += v[src[i]] * scalar for i in [0, n)
+	///
+	/// Row update of a sparse elimination with precomputed positions.
+	/// src and dst must not overlap.
+	template<typename T, typename I>
+	void vec_add_mult_scalar_idx(const std::size_t n, T * v, const I * dst, const I * src, T scalar) noexcept
+	{
+		for ( std::size_t i = 0; i < n; i++ )
+			v[dst[i]] += v[src[i]] * scalar;
+	}
+
 	template<typename R, typename V>
 	void vec_add_ip(R & result, const V & v) noexcept
 	{
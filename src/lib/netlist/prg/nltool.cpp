@@ -71,6 +71,7 @@ public:
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)"),
 		opt_boostlib(*this,  "",  "boost_lib", "builtin",   "generic: will use generic solvers.\nbuiltin: Use optimized solvers compiled in.\nsomelib.so: Use library with precompiled solvers."),
 		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
+		opt_parallel(*this, "",  "parallel",    0,          "run independent matrix solvers on this many threads (overrides the solver PARALLEL parameter)"),
 		opt_logs(*this,     "l", "log" ,                    "define terminal to log. This option may be specified repeatedly."),
 		opt_inp(*this,      "i", "input",       "",         "input file to process (default is none)"),
 		opt_loadstate(*this,"",  "loadstate",   "",         "load state from file and continue from there"),
@@ -142,6 +143,7 @@ private:
 	plib::option_num<netlist::nl_fptype> opt_ttr;
 	plib::option_str    opt_boostlib;
 	plib::option_bool   opt_stats;
+	plib::option_num<unsigned> opt_parallel;
 	plib::option_vec    opt_logs;
 	plib::option_str    opt_inp;
 	plib::option_str    opt_loadstate;
@@ -458,6 +460,16 @@ void tool_app_t::run()
 			opt_logs(),
 			m_defines, opt_rfolders(), opt_includes());
 
+	if (opt_parallel.was_specified())
+	{
+		auto *solver(nt.get_single_device<netlist::devices::NETLIB_NAME(solver)>("solver"));
+		if (solver == nullptr)
+			throw netlist::nl_exception("nltool: --parallel needs a netlist with a solver");
+		auto p(nt.setup().find_param(solver->name() + ".PARALLEL"));
+		plib::downcast<netlist::param_int_t &>(p.param()).set(static_cast<int>(opt_parallel()));
+		pout("solver threads ==> {1}\n", opt_parallel());
+	}
+
 	// Inputs must be read before reset -> will clear setup and parser
 	inps = read_input(nt.setup(), opt_inp());
 	nt.free_setup_resources();
@@ -307,8 +307,19 @@ namespace solver
 			return std::pair<pstring, pstring>("", plib::pfmt("/* solver doesn't support static compile */\n\n"));
 		}
 
+		/// \brief True if solve uses code from the static solver library
+		///
+		/// Solvers which could use pre-generated code but did not find it
+		/// fall back to the generic implementation.
+		virtual bool has_static_solver() const noexcept { return false; }
+
+		/// \brief Name of the solution method, as used by the METHOD parameter
+		virtual const char *solver_type() const noexcept = 0;
+
 		// return number of floating point operations for solve
 		constexpr std::size_t ops() const { return m_ops; }
+		std::size_t net_count() const noexcept { return m_terms.size(); }
+		std::size_t solve_count() const noexcept { return m_stat_vsolver_calls; }
 
 	protected:
 		matrix_solver_t(devices::nld_solver &main_solver, const pstring &name,
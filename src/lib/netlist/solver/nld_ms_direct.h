@@ -34,6 +34,7 @@ namespace solver
 			const solver::solver_parameters_t *params, std::size_t size);
 
 		void reset() override { matrix_solver_t::reset(); }
+		const char *solver_type() const noexcept override { return "MAT"; }
 
 	private:
 
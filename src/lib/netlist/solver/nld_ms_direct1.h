@@ -30,6 +30,8 @@ namespace solver
 			: matrix_solver_direct_t<FT, 1>(main_solver, name, nets, params, 1)
 			{}
 
+		const char *solver_type() const noexcept override { return "DIRECT1"; }
+
 		// ----------------------------------------------------------------------------------------
 		// matrix_solver - Direct1
 		// ----------------------------------------------------------------------------------------
@@ -33,6 +33,7 @@ namespace solver
 			const solver::solver_parameters_t *params)
 		: matrix_solver_direct_t<FT, 2>(main_solver, name, nets, params, 2)
 		{}
+		const char *solver_type() const noexcept override { return "DIRECT2"; }
 		void vsolve_non_dynamic() override
 		{
 			this->clear_square_mat(this->m_A);
@@ -64,6 +64,7 @@ namespace solver
 			this->log_fill(fill, mat);
 
 			mat.build_from_fill_mat(fill);
+			mat.build_elimination_scheme();
 
 			for (mat_index_type k=0; k<iN; k++)
 			{
@@ -108,8 +109,12 @@ namespace solver
 			}
 		}
 
+		const char *solver_type() const noexcept override { return "MAT_CR"; }
+
 		void vsolve_non_dynamic() override;
 
+		bool has_static_solver() const noexcept override { return m_proc.resolved(); }
+
 		std::pair<pstring, pstring> create_solver_code(static_compile_target target) override;
 
 	private:
@@ -331,7 +336,7 @@ namespace solver
 			// now solve it
 			// parallel is slow -- very slow
 			// mat.gaussian_elimination_parallel(RHS);
-			mat.gaussian_elimination(this->m_RHS);
+			mat.gaussian_elimination_scheme(this->m_RHS);
 			// backward substitution
 			mat.gaussian_back_substitution(this->m_new_V, this->m_RHS);
 		}
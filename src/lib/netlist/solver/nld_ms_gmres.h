@@ -79,6 +79,8 @@ namespace solver
 			}
 		}
 
+		const char *solver_type() const noexcept override { return "GMRES"; }
+
 		void vsolve_non_dynamic() override;
 
 	private:
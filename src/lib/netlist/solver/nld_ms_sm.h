@@ -64,6 +64,7 @@ namespace solver
 		}
 
 		void reset() override { matrix_solver_t::reset(); }
+		const char *solver_type() const noexcept override { return "SM"; }
 
 	protected:
 		void vsolve_non_dynamic() override;
@@ -39,6 +39,8 @@ namespace solver
 			{
 			}
 
+		const char *solver_type() const noexcept override { return "SOR"; }
+
 		void vsolve_non_dynamic() override;
 
 	private:
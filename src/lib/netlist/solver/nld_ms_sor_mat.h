@@ -37,6 +37,8 @@ namespace solver
 			{
 			}
 
+		const char *solver_type() const noexcept override { return "SOR_MAT"; }
+
 		void vsolve_non_dynamic() override;
 
 	private:
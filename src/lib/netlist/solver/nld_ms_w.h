@@ -70,6 +70,7 @@ namespace solver
 		}
 
 		void reset() override { matrix_solver_t::reset(); }
+		const char *solver_type() const noexcept override { return "W"; }
 
 	protected:
 		void vsolve_non_dynamic() override;
@@ -44,17 +44,46 @@ namespace devices
 
 	void NETLIB_NAME(solver)::stop()
 	{
+		m_pool.reset();
+		log_solver_report();
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
 	}
 
+	void NETLIB_NAME(solver)::log_solver_report()
+	{
+		if (m_mat_solvers.empty() || !log().verbose.is_enabled())
+			return;
+
+		std::size_t nstatic = 0;
+		for (auto &s : m_mat_solvers)
+			if (s->has_static_solver())
+				nstatic++;
+
+		log().verbose("Solver report: {1} solvers, {2} using static code", m_mat_solvers.size(), nstatic);
+		for (auto &s : m_mat_solvers)
+		{
+			pstring kind(s->solver_type());
+			if (s->has_static_solver())
+				kind += " static";
+			auto *st = s->stats();
+			if (st != nullptr && st->m_stat_total_time.count() > 0)
+				log().verbose("    {1:30} {2:4} nets {3:14} {4:10} calls {5:12} ticks/call", s->name(),
+					s->net_count(), kind, st->m_stat_total_time.count(),
+					st->m_stat_total_time.total() / st->m_stat_total_time.count());
+			else
+				log().verbose("    {1:30} {2:4} nets {3:14} {4:10} calls", s->name(),
+					s->net_count(), kind, s->solve_count());
+		}
+	}
+
 #if 1
 
 	template<bool KEEP_STATS>
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t nthreads = m_params.m_parallel() < 2 ? 1 : std::min(static_cast<std::size_t>(m_params.m_parallel()), plib::omp::get_max_threads());
+		const std::size_t nthreads = m_params.m_parallel() < 2 ? 1 : std::min(static_cast<std::size_t>(m_params.m_parallel()), m_mat_solvers.size());
 		const netlist_time_ext sched(now + (nthreads <= 1 ? netlist_time_ext::zero() : netlist_time_ext::from_nsec(100)));
 		plib::uninitialised_array<solver::matrix_solver_t *, config::MAX_SOLVER_QUEUE_SIZE::value> tmp; //NOLINT
 		plib::uninitialised_array<netlist_time, config::MAX_SOLVER_QUEUE_SIZE::value> nt; //NOLINT
@@ -71,9 +100,11 @@ namespace devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Solvers are independent within a step: each only touches its own
+		// nets, and inputs are updated afterwards in queue order. Parallel
+		// solving only pays off for several large solvers, so it is opt-in
+		// via the PARALLEL parameter and stays off when gathering stats.
+		if (KEEP_STATS || nthreads < 2 || p < 2)
 		{
 			if (!KEEP_STATS)
 			{
@@ -101,11 +132,13 @@ namespace devices
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p, [&tmp, &nt,now](std::size_t i)
+			if (!m_pool || m_pool->threads() != nthreads)
+				m_pool = std::make_unique<plib::pworker_pool>(nthreads);
+			auto solve_one = [&tmp, &nt, now](std::size_t i)
 				{
 					nt[i] = tmp[i]->solve(now, "parallel");
-				});
+				};
+			m_pool->run(p, solve_one);
 			for (std::size_t i = 0; i < p; i++)
 			{
 				if (nt[i] != netlist_time::zero())
@@ -9,6 +9,7 @@
 ///
 
 #include "../nl_base.h"
+#include "../plib/pmulti_threading.h"
 #include "../plib/pstream.h"
 #include "nld_matrix_solver.h"
 
@@ -76,6 +77,9 @@ namespace devices
 		solver::solver_parameters_t m_params;
 		queue_type m_queue;
 
+		// workers for PARALLEL >= 2, created on first use
+		std::unique_ptr<plib::pworker_pool> m_pool;
+
 		template <typename FT, int SIZE>
 		solver_ptr create_solver(std::size_t size, const pstring &solvername,
 			const solver::solver_parameters_t *params,net_list_t &nets);
@@ -86,6 +90,7 @@ namespace devices
 
 		std::size_t get_solver_id(const solver::matrix_solver_t *net) const;
 		solver::matrix_solver_t *solver_by_id(std::size_t id) const;
+		void log_solver_report();
 
 	};
 
@@ -78,4 +78,76 @@ public:
 };
 }
 
+
+/***************************************************************************
+
+    Binary instruction trace format, written by the debugger trace
+    command and disassembled again by unidasm -trace.
+
+    A trace file is a sequence of chunks, each starting with a 32-bit
+    little-endian tag and a 32-bit little-endian payload length:
+
+    HEADER: describes the traced device, followed by DATA chunks
+        u8      version
+        s8      address shift of the program space
+        u8      endianness (0 = little, 1 = big)
+        u8      options (OPTION_*)
+        u32     program space logical address mask
+        u8      opcode alignment (in PC units)
+        str     device tag
+        str     device short name
+        u16     number of registers, each a str with the symbol
+        u8      number of address spaces, each a str with the name
+
+    DATA: a block of records, compressed with zlib
+        u32     uncompressed size
+        ...     zlib stream
+
+    Records within a block, all values little-endian:
+
+    INSTRUCTION: executed at pc, before it runs
+        u32     pc
+        u8      opcode data size, followed by the data
+        u8      parameter data size, followed by the data
+    REGISTERS: registers changed by the previous instruction
+        u16     count, then u16 index and u64 value for each
+    MEMORY_READ/MEMORY_WRITE: access made by the previous instruction
+        u8      space index
+        u32     address
+        u64     data
+        u64     mem_mask
+    TEXT: logerror or trace_printf output
+        u16     length, followed by the characters
+
+    Strings are a u8 length followed by the characters. Opcode data is
+    the debugger's data_get output: one little-endian unit per PC step.
+
+***************************************************************************/
+
+namespace util { namespace trace_format {
+
+// chunk tags
+constexpr uint32_t CHUNK_HEADER     = 0x4852544d;   // 'MTRH'
+constexpr uint32_t CHUNK_DATA       = 0x4452544d;   // 'MTRD'
+
+// header values
+constexpr uint8_t VERSION           = 1;
+constexpr uint8_t OPTION_REGISTERS  = 0x01;         // REGISTERS records present
+constexpr uint8_t OPTION_MEMORY     = 0x02;         // MEMORY_* records present
+
+// uncompressed size that triggers a new DATA chunk
+constexpr uint32_t BLOCK_SIZE       = 0x40000;
+
+// record types
+enum record_type : uint8_t
+{
+	INSTRUCTION = 1,
+	REGISTERS,
+	MEMORY_READ,
+	MEMORY_WRITE,
+	TEXT
+};
+
+} } // namespace util::trace_format
+
 #endif
@@ -159,6 +159,21 @@ TIMER_DEVICE_CALLBACK_MEMBER(model2_state::model2_timer_cb)
 	m_timerrun[tnum] = 0;
 }
 
+// texture RAM is plain RAM on Model 2B/2C, watch it for the decoded texture cache
+void model2_state::install_texture_taps()
+{
+	address_space &space = m_maincpu->space(AS_PROGRAM);
+
+	space.install_write_tap(0x11000000, 0x111fffff, "texture0", [this](offs_t offset, u32 &data, u32 mem_mask)
+	{
+		m_texcache[0].mark_dirty((offset - 0x11000000) >> 2);
+	});
+	space.install_write_tap(0x11200000, 0x113fffff, "texture1", [this](offs_t offset, u32 &data, u32 mem_mask)
+	{
+		m_texcache[1].mark_dirty((offset - 0x11200000) >> 2);
+	});
+}
+
 void model2_state::machine_start()
 {
 	// initialize custom debugger pool, @see machine/model2.cpp
@@ -211,6 +226,8 @@ void model2b_state::machine_start()
 {
 	model2_state::machine_start();
 
+	install_texture_taps();
+
 	m_copro_fifo_in->setup(16,
 						   [    ]() { },
 						   [    ]() { },
@@ -233,6 +250,8 @@ void model2c_state::machine_start()
 {
 	model2_state::machine_start();
 
+	install_texture_taps();
+
 	m_copro_fifo_in->setup(16,
 						   [    ]() { },
 						   [    ]() { },
@@ -1058,6 +1077,8 @@ void model2_state::render_mode_w(u32 data)
 
 void model2_tgp_state::tex0_w(offs_t offset, u32 data)
 {
+	m_texcache[0].mark_dirty(offset >> 1);
+
 	if ( (offset & 1) == 0 )
 	{
 		m_textureram0[offset>>1] &= 0xffff0000;
@@ -1072,6 +1093,8 @@ void model2_tgp_state::tex0_w(offs_t offset, u32 data)
 
 void model2_tgp_state::tex1_w(offs_t offset, u32 data)
 {
+	m_texcache[1].mark_dirty(offset >> 1);
+
 	if ( (offset & 1) == 0 )
 	{
 		m_textureram1[offset>>1] &= 0xffff0000;
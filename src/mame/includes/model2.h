@@ -31,6 +31,36 @@
 
 class model2_renderer;
 
+/*
+    Model 2 texture sheets hold 4bpp texels packed as 2x2 blocks per
+    16-bit word.  The cache keeps each texel expanded to a byte at the
+    same linear position, so the rasterizer fetches with a single load.
+    Texture RAM writes only mark pages dirty; dirty pages are expanded
+    again on the emulation thread before a frame is rendered.
+*/
+class model2_texture_cache
+{
+public:
+	void init(u32 *sheet, u32 bytes);
+
+	void mark_dirty(u32 word) { m_dirty[(word & m_word_mask) >> PAGE_SHIFT] = true; m_any_dirty = true; }
+	void mark_all_dirty();
+	void refresh();
+
+	const u8 *texels() const { return m_texels.get(); }
+	u32 texel_mask() const { return m_texel_mask; }
+
+private:
+	static constexpr int PAGE_SHIFT = 10;   // 4KB of texture RAM per dirty page
+
+	u32 *                   m_sheet = nullptr;
+	u32                     m_word_mask = 0;
+	u32                     m_texel_mask = 0;
+	std::unique_ptr<u8[]>   m_texels;
+	std::unique_ptr<bool[]> m_dirty;
+	bool                    m_any_dirty = false;
+};
+
 class model2_state : public driver_device
 {
 public:
@@ -79,6 +109,7 @@ public:
 	std::unique_ptr<u16[]> m_lumaram;
 	u8 m_gamma_table[256];
 	std::unique_ptr<model2_renderer> m_poly;
+	model2_texture_cache m_texcache[2];
 
 	/* Public for access by the ioports */
 	DECLARE_CUSTOM_INPUT_MEMBER(daytona_gearbox_r);
@@ -104,6 +135,8 @@ protected:
 	virtual void machine_start() override;
 	virtual void machine_reset() override;
 
+	void install_texture_taps();
+
 	required_shared_ptr<u32> m_workram;
 	required_shared_ptr<u32> m_bufferram;
 	std::unique_ptr<u16[]> m_fbvramA;
@@ -254,6 +287,7 @@ protected:
 	void debug_help_command(int ref, const std::vector<std::string> &params);
 
 	virtual void video_start() override;
+	virtual void device_post_load() override;
 
 	u32 m_intreq;
 	u32 m_intena;
@@ -303,10 +337,13 @@ private:
 	void geo_parse_np_s( geo_state *geo, u32 *input, u32 count );
 	void geo_parse_nn_ns( geo_state *geo, u32 *input, u32 count );
 	void geo_parse_nn_s( geo_state *geo, u32 *input, u32 count );
+	template <bool NormalsPresent, bool Specular> void geo_parse_strip( geo_state *geo, u32 *input, u32 count );
+	u32 geo_transform_strip( geo_state *geo, u32 *input, u32 count, bool normals );
 
 	// raster functions
 	// main data input port
 	void model2_3d_push( raster_state *raster, u32 input );
+	void model2_3d_push_batch( raster_state *raster, const u32 *input, u32 count );
 	// quad & triangle push paths
 	void model2_3d_process_quad( raster_state *raster, u32 attr );
 	void model2_3d_process_triangle( raster_state *raster, u32 attr );
@@ -598,7 +635,8 @@ struct m2_poly_extra_data
 	model2_state *  state;
 	u32      lumabase;
 	u32      colorbase;
-	u32 *    texsheet;
+	const u8 *textexels;
+	u32      texmask;
 	u32      texwidth;
 	u32      texheight;
 	u32      texx, texy;
@@ -607,23 +645,13 @@ struct m2_poly_extra_data
 };
 
 
-static inline u16 get_texel( u32 base_x, u32 base_y, int x, int y, u32 *sheet )
+static inline u16 get_cached_texel( u32 base_x, u32 base_y, int x, int y, const u8 *texels, u32 mask )
 {
 	u32  baseoffs = ((base_y/2)*512)+(base_x/2);
 	u32  texeloffs = ((y/2)*512)+(x/2);
 	u32  offset = baseoffs + texeloffs;
-	u32  texel = sheet[offset>>1];
-
-	if ( offset & 1 )
-		texel >>= 16;
-
-	if ( (y & 1) == 0 )
-		texel >>= 8;
-
-	if ( (x & 1) == 0 )
-		texel >>= 4;
 
-	return (texel & 0x0f);
+	return texels[((offset << 2) | ((y & 1) << 1) | (x & 1)) & mask];
 }
 
 // 0x10000 = size of the tri_sorted_list array
@@ -852,6 +880,8 @@ struct model2_state::geo_state
 	u32                 polygon_ram0[0x8000];       // Fast Polygon RAM pointer
 	u32                 polygon_ram1[0x8000];       // Slow Polygon RAM pointer
 	model2_state *      state = nullptr;
+	std::vector<float>  batch_x, batch_y, batch_z;      // Transformed strip points
+	std::vector<float>  batch_nx, batch_ny, batch_nz;   // Transformed strip normals
 };
 
 #endif // MAME_INCLUDES_MODEL2_H
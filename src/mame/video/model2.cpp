@@ -794,7 +794,9 @@ void model2_renderer::model2_3d_render(triangle *tri, const rectangle &cliprect)
 		/* TODO: Virtua Striker contradicts with this. */
 		extra.texmirrorx = 0;//(tri->texheader[0] >> 9) & 1;
 		extra.texmirrory = 0;//(tri->texheader[0] >> 8) & 1;
-		extra.texsheet = (tri->texheader[2] & 0x1000) ? m_state.m_textureram1 : m_state.m_textureram0;
+		const model2_texture_cache &texcache = m_state.m_texcache[(tri->texheader[2] & 0x1000) ? 1 : 0];
+		extra.textexels = texcache.texels();
+		extra.texmask = texcache.texel_mask();
 
 		tri->v[0].pz = 1.0f / (1.0f + tri->v[0].pz);
 		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * (1.0f / 8.0f);
@@ -904,9 +906,26 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 	raster_state *raster = m_raster.get();
 	int32_t z;
 
+	/* when pipelined, show the frame that was rendered while this one was emulated;
+	   once it is copied out the bitmap is free for the new frame */
+	bool const pipelined = m_poly->pipelined();
+	if (pipelined)
+	{
+		m_poly->wait("Previous frame");
+		copybitmap_trans(bitmap, m_poly->destmap(), 0, 0, 0, 0, cliprect, 0x00000000);
+	}
+
+	/* bring the decoded textures up to date; nothing is rendering at this point */
+	m_texcache[0].refresh();
+	m_texcache[1].refresh();
+
 	/* if we have nothing to render, bail */
 	if ( raster->tri_list_index == 0 )
+	{
+		if (pipelined)
+			m_poly->destmap().fill(0x00000000, cliprect);
 		return;
+	}
 
 	m_poly->destmap().fill(0x00000000, cliprect);
 
@@ -930,6 +949,13 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 			}
 		}
 	}
+	/* let it render in the background until the next update */
+	if (pipelined)
+	{
+		m_poly->flush();
+		return;
+	}
+
 	m_poly->wait("End of frame");
 
 	copybitmap_trans(bitmap, m_poly->destmap(), 0, 0, 0, 0, cliprect, 0x00000000);
@@ -960,6 +986,31 @@ void model2_state::draw_framebuffer( bitmap_rgb32 &bitmap, const rectangle &clip
 	}
 }
 
+/* 3D Rasterizer block input, used by the geometry engine for whole polygons */
+void model2_state::model2_3d_push_batch( raster_state *raster, const u32 *input, u32 count )
+{
+	/* a complete polygon arriving while object data waits for its next
+	   attribute word goes straight to the quad/triangle setup */
+	if ( raster->cur_command == 1 && raster->command_index == 8 && count >= 6 )
+	{
+		const u32 attr = input[0];
+
+		if ( (attr & 3) != 0 && count == ((attr & 1) ? 9 : 6) )
+		{
+			std::copy( input, input + count, &raster->command_buffer[8] );
+
+			if ( attr & 1 )
+				model2_3d_process_quad( raster, attr );
+			else
+				model2_3d_process_triangle( raster, attr );
+			return;
+		}
+	}
+
+	for ( u32 i = 0; i < count; i++ )
+		model2_3d_push( raster, input[i] );
+}
+
 /* 3D Rasterizer main data input port */
 void model2_state::model2_3d_push( raster_state *raster, u32 input )
 {
@@ -1180,604 +1231,166 @@ void model2_state::geo_init(memory_region *polygon_rom)
  *
  *******************************************/
 
-/* Parse Polygons: Normals Present, No Specular case */
-void model2_state::geo_parse_np_ns( geo_state *geo, u32 *input, u32 count )
-{
-	raster_state *raster = geo->raster;
-	poly_vertex point, normal;
-	u32  attr, i;
-
-	/* read the 1st point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-	/* read the 2nd point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
+/*
+    Polygon data is a strip: two points, then up to 'count' links of
+    10 words each (attributes, normal, P0(n), P1(n)), ending at the first
+    link that is neither a quad nor a triangle.  Every point and normal of
+    the strip is transformed up front into structure-of-arrays buffers,
+    which keeps the matrix multiply in tight loops the compiler can
+    vectorize, and each finished polygon is handed to the rasterizer as
+    one block instead of word by word.
+*/
 
-	/* apply focus */
-	apply_focus( geo, &point );
+u32 model2_state::geo_transform_strip( geo_state *geo, u32 *input, u32 count, bool normals )
+{
+	const float *matrix = geo->matrix;
+	u32 links = 0;
 
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
+	while ( links < count && (input[6 + links * 10] & 3) != 0 )
+		links++;
 
-	/* loop through the following links */
-	for( i = 0; i < count; i++ )
+	const u32 points = 2 + links * 2;
+	if ( geo->batch_x.size() < points )
 	{
-		/* read in the attributes */
-		attr = *input++;
-
-		/* push to the 3d rasterizer */
-		model2_3d_push( raster, attr & 0x0003FFFF );
-
-		/* read in the normal */
-		normal.x = u2f(*input++);
-		normal.y = u2f(*input++);
-		normal.pz = u2f(*input++);
-
-		/* transform with the current matrix */
-		transform_vector( &normal, geo->matrix );
-
-		if ( (attr & 3) != 0 ) /* quad or triangle */
-		{
-			float               dotl, dotp, luminance, distance;
-			float               coef, face;
-			int32_t               luma;
-			texture_parameter * texparam;
-
-			/* read in the next point */
-			point.x = u2f( *input++ );
-			point.y = u2f( *input++ );
-			point.pz = u2f( *input++ );
-
-			/* transform with the current matrix */
-			transform_point( &point, geo->matrix );
-
-			/* calculate the dot product of the normal and the light vector */
-			dotl = dot_product( &normal, &geo->light );
-
-			/* calculate the dot product of the normal and the point */
-			dotp = dot_product( &normal, &point );
-
-			/* apply focus */
-			apply_focus( geo, &point );
-
-			/* determine whether this is the front or the back of the polygon */
-			face = 0x100; /* rear */
-			if ( dotp >= 0 ) face = 0; /* front */
-
-			/* get the texture parameters */
-			texparam = &geo->texture_parameters[(attr>>18) & 0x1f];
-
-			/* calculate luminance */
-			if ( (dotl * dotp) < 0 ) luminance = 0;
-			else luminance = fabs( dotl );
-
-			luminance = (luminance * texparam->diffuse) + texparam->ambient;
-			luma = (int32_t)luminance;
-
-			if ( luma > 255 ) luma = 255;
-			if ( luma < 0 ) luma = 0;
-
-			/* add the face bit to the luma */
-			luma += face;
-
-			/* extract distance coefficient */
-			coef = geo->coef_table[attr>>27];
-
-			/* calculate texture level of detail */
-			distance = coef * fabs( dotp ) * geo->lod;
-
-			/* push to the 3d rasterizer */
-			model2_3d_push( raster, luma << 15 );
-			model2_3d_push( raster, f2u(distance) >> 8 );
-			model2_3d_push( raster, f2u(point.x) >> 8 );
-			model2_3d_push( raster, f2u(point.y) >> 8 );
-			model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-			/* if it's a quad, push one more point */
-			if ( attr & 1 )
-			{
-				/* read in the next point */
-				point.x = u2f( *input++ );
-				point.y = u2f( *input++ );
-				point.pz = u2f( *input++ );
-
-				/* transform with the current matrix */
-				transform_point( &point, geo->matrix );
-
-				/* apply focus */
-				apply_focus( geo, &point );
-
-				/* push to the 3d rasterizer */
-				model2_3d_push( raster, f2u(point.x) >> 8 );
-				model2_3d_push( raster, f2u(point.y) >> 8 );
-				model2_3d_push( raster, f2u(point.pz) >> 8 );
-			}
-			else /* triangle */
-			{
-				/* skip the next 3 points */
-				input += 3;
-			}
-		}
-		else /* we're done */
-		{
-			break;
-		}
+		geo->batch_x.resize( points );
+		geo->batch_y.resize( points );
+		geo->batch_z.resize( points );
+		geo->batch_nx.resize( points );
+		geo->batch_ny.resize( points );
+		geo->batch_nz.resize( points );
 	}
 
-	/* notify the 3d rasterizer we're done */
-	model2_3d_push( raster, 0 );
-}
-
-/* Parse Polygons: Normals Present, Specular case */
-void model2_state::geo_parse_np_s( geo_state *geo, u32 *input, u32 count )
-{
-	raster_state *raster = geo->raster;
-	poly_vertex point, normal;
-	u32  attr, i;
-
-	/* read the 1st point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
+	float *x = &geo->batch_x[0];
+	float *y = &geo->batch_y[0];
+	float *z = &geo->batch_z[0];
 
-	/* read the 2nd point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
+	/* gather P0(n) and P1(n) of every link after the first two points */
+	for ( u32 i = 0; i < points; i++ )
+	{
+		const u32 *src = (i < 2) ? &input[i * 3] : &input[6 + ((i - 2) >> 1) * 10 + 4 + ((i - 2) & 1) * 3];
+		x[i] = u2f( src[0] );
+		y[i] = u2f( src[1] );
+		z[i] = u2f( src[2] );
+	}
 
 	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-	/* loop through the following links */
-	for( i = 0; i < count; i++ )
+	for ( u32 i = 0; i < points; i++ )
 	{
-		/* read in the attributes */
-		attr = *input++;
-
-		/* push to the 3d rasterizer */
-		model2_3d_push( raster, attr & 0x0003FFFF );
-
-		/* read in the normal */
-		normal.x = u2f(*input++);
-		normal.y = u2f(*input++);
-		normal.pz = u2f(*input++);
+		const float tx = (x[i] * matrix[0]) + (y[i] * matrix[3]) + (z[i] * matrix[6]) + (matrix[9]);
+		const float ty = (x[i] * matrix[1]) + (y[i] * matrix[4]) + (z[i] * matrix[7]) + (matrix[10]);
+		const float tz = (x[i] * matrix[2]) + (y[i] * matrix[5]) + (z[i] * matrix[8]) + (matrix[11]);
+		x[i] = tx;
+		y[i] = ty;
+		z[i] = tz;
+	}
 
-		/* transform with the current matrix */
-		transform_vector( &normal, geo->matrix );
+	if ( normals )
+	{
+		float *nx = &geo->batch_nx[0];
+		float *ny = &geo->batch_ny[0];
+		float *nz = &geo->batch_nz[0];
 
-		if ( (attr & 3) != 0 ) /* quad or triangle */
+		for ( u32 i = 0; i < links; i++ )
 		{
-			float               dotl, dotp, luminance, distance, specular;
-			float               coef, face;
-			int32_t               luma;
-			texture_parameter * texparam;
-
-			/* read in the next point */
-			point.x = u2f( *input++ );
-			point.y = u2f( *input++ );
-			point.pz = u2f( *input++ );
-
-			/* transform with the current matrix */
-			transform_point( &point, geo->matrix );
-
-			/* calculate the dot product of the normal and the light vector */
-			dotl = dot_product( &normal, &geo->light );
-
-			/* calculate the dot product of the normal and the point */
-			dotp = dot_product( &normal, &point );
-
-			/* apply focus */
-			apply_focus( geo, &point );
-
-			/* determine whether this is the front or the back of the polygon */
-			face = 0x100; /* rear */
-			if ( dotp >= 0 ) face = 0; /* front */
-
-			/* get the texture parameters */
-			texparam = &geo->texture_parameters[(attr>>18) & 0x1f];
-
-			/* calculate luminance and specular */
-			if ( (dotl * dotp) < 0 ) luminance = 0;
-			else luminance = fabs( dotl );
-
-			specular = ((2*dotl) * normal.pz) - geo->light.pz;
-			if ( specular < 0 ) specular = 0;
-			if ( texparam->specular_control == 0 ) specular = 0;
-			if ( (texparam->specular_control >> 1) != 0 ) specular *= specular;
-			if ( (texparam->specular_control >> 2) != 0 ) specular *= specular;
-			if ( ((texparam->specular_control+1) >> 3) != 0 ) specular *= specular;
-
-			specular *= texparam->specular_scale;
-
-			luminance = (luminance * texparam->diffuse) + texparam->ambient + specular;
-			luma = (int32_t)luminance;
-
-			if ( luma > 255 ) luma = 255;
-			if ( luma < 0 ) luma = 0;
-
-			/* add the face bit to the luma */
-			luma += face;
-
-			/* extract distance coefficient */
-			coef = geo->coef_table[attr>>27];
-
-			/* calculate texture level of detail */
-			distance = coef * fabs( dotp ) * geo->lod;
-
-			/* push to the 3d rasterizer */
-			model2_3d_push( raster, luma << 15 );
-			model2_3d_push( raster, f2u(distance) >> 8 );
-			model2_3d_push( raster, f2u(point.x) >> 8 );
-			model2_3d_push( raster, f2u(point.y) >> 8 );
-			model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-			/* if it's a quad, push one more point */
-			if ( attr & 1 )
-			{
-				/* read in the next point */
-				point.x = u2f( *input++ );
-				point.y = u2f( *input++ );
-				point.pz = u2f( *input++ );
-
-				/* transform with the current matrix */
-				transform_point( &point, geo->matrix );
-
-				/* apply focus */
-				apply_focus( geo, &point );
-
-				/* push to the 3d rasterizer */
-				model2_3d_push( raster, f2u(point.x) >> 8 );
-				model2_3d_push( raster, f2u(point.y) >> 8 );
-				model2_3d_push( raster, f2u(point.pz) >> 8 );
-			}
-			else /* triangle */
-			{
-				/* skip the next 3 points */
-				input += 3;
-			}
+			const u32 *src = &input[6 + i * 10 + 1];
+			nx[i] = u2f( src[0] );
+			ny[i] = u2f( src[1] );
+			nz[i] = u2f( src[2] );
 		}
-		else /* we're done */
+
+		for ( u32 i = 0; i < links; i++ )
 		{
-			break;
+			const float tx = (nx[i] * matrix[0]) + (ny[i] * matrix[3]) + (nz[i] * matrix[6]);
+			const float ty = (nx[i] * matrix[1]) + (ny[i] * matrix[4]) + (nz[i] * matrix[7]);
+			const float tz = (nx[i] * matrix[2]) + (ny[i] * matrix[5]) + (nz[i] * matrix[8]);
+			nx[i] = tx;
+			ny[i] = ty;
+			nz[i] = tz;
 		}
 	}
 
-	/* notify the 3d rasterizer we're done */
-	model2_3d_push( raster, 0 );
+	return links;
 }
 
-/* Parse Polygons: No Normals, No Specular case */
-void model2_state::geo_parse_nn_ns( geo_state *geo, u32 *input, u32 count )
+static inline void batch_point( model2_state::geo_state *geo, u32 index, poly_vertex *point )
 {
-	raster_state *raster = geo->raster;
-	poly_vertex point, normal, p0, p1, p2, p3;
-	u32  attr, i;
-
-	/* read the 1st point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* save for normal calculation */
-	p0.x = point.x; p0.y = point.y; p0.pz = point.pz;
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-	/* read the 2nd point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* save for normal calculation */
-	p1.x = point.x; p1.y = point.y; p1.pz = point.pz;
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-	/* loop through the following links */
-	for( i = 0; i < count; i++ )
-	{
-		/* read in the attributes */
-		attr = *input++;
-
-		/* push to the 3d rasterizer */
-		model2_3d_push( raster, attr & 0x0003FFFF );
-
-		if ( (attr & 3) != 0 ) /* quad or triangle */
-		{
-			float               dotl, dotp, luminance, distance;
-			float               coef, face;
-			int32_t               luma;
-			texture_parameter * texparam;
-
-			/* Skip normal */
-			input += 3;
-
-			/* read in the next point */
-			point.x = u2f( *input++ );
-			point.y = u2f( *input++ );
-			point.pz = u2f( *input++ );
-
-			/* transform with the current matrix */
-			transform_point( &point, geo->matrix );
-
-			/* save for normal calculation */
-			p2.x = point.x; p2.y = point.y; p2.pz = point.pz;
-
-			/* compute the normal */
-			vector_cross3( &normal, &p0, &p1, &p2 );
-
-			/* normalize it */
-			normalize_vector( &normal );
-
-			/* calculate the dot product of the normal and the light vector */
-			dotl = dot_product( &normal, &geo->light );
-
-			/* calculate the dot product of the normal and the point */
-			dotp = dot_product( &normal, &point );
-
-			/* apply focus */
-			apply_focus( geo, &point );
-
-			/* determine whether this is the front or the back of the polygon */
-			face = 0x100; /* rear */
-			if ( dotp >= 0 ) face = 0; /* front */
-
-			/* get the texture parameters */
-			texparam = &geo->texture_parameters[(attr>>18) & 0x1f];
-
-			/* calculate luminance */
-			if ( (dotl * dotp) < 0 ) luminance = 0;
-			else luminance = fabs( dotl );
-
-			luminance = (luminance * texparam->diffuse) + texparam->ambient;
-			luma = (int32_t)luminance;
-
-			if ( luma > 255 ) luma = 255;
-			if ( luma < 0 ) luma = 0;
-
-			/* add the face bit to the luma */
-			luma += face;
-
-			/* extract distance coefficient */
-			coef = geo->coef_table[attr>>27];
-
-			/* calculate texture level of detail */
-			distance = coef * fabs( dotp ) * geo->lod;
-
-			/* push to the 3d rasterizer */
-			model2_3d_push( raster, luma << 15 );
-			model2_3d_push( raster, f2u(distance) >> 8 );
-			model2_3d_push( raster, f2u(point.x) >> 8 );
-			model2_3d_push( raster, f2u(point.y) >> 8 );
-			model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-			/* if it's a quad, push one more point */
-			if ( attr & 1 )
-			{
-				/* read in the next point */
-				point.x = u2f( *input++ );
-				point.y = u2f( *input++ );
-				point.pz = u2f( *input++ );
-
-				/* transform with the current matrix */
-				transform_point( &point, geo->matrix );
-
-				/* save for normal calculation */
-				p3.x = point.x; p3.y = point.y; p3.pz = point.pz;
-
-				/* apply focus */
-				apply_focus( geo, &point );
-
-				/* push to the 3d rasterizer */
-				model2_3d_push( raster, f2u(point.x) >> 8 );
-				model2_3d_push( raster, f2u(point.y) >> 8 );
-				model2_3d_push( raster, f2u(point.pz) >> 8 );
-			}
-			else
-			{
-				/* skip the next 3 points */
-				input += 3;
-
-				/* for triangles, the rope of P1(n) is achieved by P0(n-1) (linktype 3) */
-				p3.x = p2.x; p3.y = p2.y; p3.pz = p2.pz;
-			}
-		}
-		else /* we're done */
-		{
-			break;
-		}
-
-		/* link type */
-		switch( (attr>>8) & 3 )
-		{
-			case 0:
-			case 2:
-			{
-				/* reuse P0(n) and P1(n) */
-				p0.x = p2.x; p0.y = p2.y; p0.pz = p2.pz;
-				p1.x = p3.x; p1.y = p3.y; p1.pz = p3.pz;
-			}
-			break;
-
-			case 1:
-			{
-				/* reuse P0(n-1) and P0(n) */
-				p1.x = p2.x; p1.y = p2.y; p1.pz = p2.pz;
-			}
-			break;
-
-			case 3:
-			{
-				/* reuse P1(n-1) and P1(n) */
-				p0.x = p3.x; p0.y = p3.y; p0.pz = p3.pz;
-			}
-			break;
-		}
-	}
+	point->x = geo->batch_x[index];
+	point->y = geo->batch_y[index];
+	point->pz = geo->batch_z[index];
+}
 
-	/* notify the 3d rasterizer we're done */
-	model2_3d_push( raster, 0 );
+/* apply focus and convert to the rasterizer's input format */
+static inline void encode_point( model2_state::geo_state *geo, const poly_vertex *point, u32 *dst )
+{
+	dst[0] = f2u(point->x * geo->focus.x) >> 8;
+	dst[1] = f2u(point->y * geo->focus.y) >> 8;
+	dst[2] = f2u(point->pz) >> 8;
 }
 
-/* Parse Polygons: No Normals, Specular case */
-void model2_state::geo_parse_nn_s( geo_state *geo, u32 *input, u32 count )
+template <bool NormalsPresent, bool Specular>
+void model2_state::geo_parse_strip( geo_state *geo, u32 *input, u32 count )
 {
 	raster_state *raster = geo->raster;
 	poly_vertex point, normal, p0, p1, p2, p3;
-	u32  attr, i;
-
-	/* read the 1st point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
-
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* save for normal calculation */
-	p0.x = point.x; p0.y = point.y; p0.pz = point.pz;
-
-	/* apply focus */
-	apply_focus( geo, &point );
-
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
-
-	/* read the 2nd point */
-	point.x = u2f( *input++ );
-	point.y = u2f( *input++ );
-	point.pz = u2f( *input++ );
+	u32 words[9];
 
-	/* transform with the current matrix */
-	transform_point( &point, geo->matrix );
-
-	/* save for normal calculation */
-	p1.x = point.x; p1.y = point.y; p1.pz = point.pz;
-
-	/* apply focus */
-	apply_focus( geo, &point );
+	const u32 links = geo_transform_strip( geo, input, count, NormalsPresent );
 
-	/* push it to the 3d rasterizer */
-	model2_3d_push( raster, f2u(point.x) >> 8 );
-	model2_3d_push( raster, f2u(point.y) >> 8 );
-	model2_3d_push( raster, f2u(point.pz) >> 8 );
+	/* push the first two points to the 3d rasterizer */
+	batch_point( geo, 0, &p0 );
+	batch_point( geo, 1, &p1 );
+	encode_point( geo, &p0, &words[0] );
+	encode_point( geo, &p1, &words[3] );
+	model2_3d_push_batch( raster, words, 6 );
 
 	/* loop through the following links */
-	for( i = 0; i < count; i++ )
+	for( u32 i = 0; i < links; i++ )
 	{
-		/* read in the attributes */
-		attr = *input++;
+		const u32 attr = input[6 + i * 10];
+		float               dotl, dotp, luminance, distance;
+		float               coef, face;
+		int32_t             luma;
+		texture_parameter * texparam;
 
-		/* push to the 3d rasterizer */
-		model2_3d_push( raster, attr & 0x0003FFFF );
+		/* P0(n) */
+		batch_point( geo, 2 + i * 2, &point );
+		p2 = point;
 
-		if ( (attr & 3) != 0 ) /* quad or triangle */
+		if ( NormalsPresent )
+		{
+			normal.x = geo->batch_nx[i];
+			normal.y = geo->batch_ny[i];
+			normal.pz = geo->batch_nz[i];
+		}
+		else
 		{
-			float               dotl, dotp, luminance, distance, specular;
-			float               coef, face;
-			int32_t               luma;
-			texture_parameter * texparam;
-
-			/* Skip normal */
-			input += 3;
-
-			/* read in the next point */
-			point.x = u2f( *input++ );
-			point.y = u2f( *input++ );
-			point.pz = u2f( *input++ );
-
-			/* transform with the current matrix */
-			transform_point( &point, geo->matrix );
-
-			/* save for normal calculation */
-			p2.x = point.x; p2.y = point.y; p2.pz = point.pz;
-
 			/* compute the normal */
 			vector_cross3( &normal, &p0, &p1, &p2 );
 
 			/* normalize it */
 			normalize_vector( &normal );
+		}
 
-			/* calculate the dot product of the normal and the light vector */
-			dotl = dot_product( &normal, &geo->light );
-
-			/* calculate the dot product of the normal and the point */
-			dotp = dot_product( &normal, &point );
+		/* calculate the dot product of the normal and the light vector */
+		dotl = dot_product( &normal, &geo->light );
 
-			/* apply focus */
-			apply_focus( geo, &point );
+		/* calculate the dot product of the normal and the point */
+		dotp = dot_product( &normal, &point );
 
-			/* determine whether this is the front or the back of the polygon */
-			face = 0x100; /* rear */
-			if ( dotp >= 0 ) face = 0; /* front */
+		/* determine whether this is the front or the back of the polygon */
+		face = 0x100; /* rear */
+		if ( dotp >= 0 ) face = 0; /* front */
 
-			/* get the texture parameters */
-			texparam = &geo->texture_parameters[(attr>>18) & 0x1f];
+		/* get the texture parameters */
+		texparam = &geo->texture_parameters[(attr>>18) & 0x1f];
 
-			/* calculate luminance and specular */
-			if ( (dotl * dotp) < 0 ) luminance = 0;
-			else luminance = fabs( dotl );
+		/* calculate luminance */
+		if ( (dotl * dotp) < 0 ) luminance = 0;
+		else luminance = fabs( dotl );
 
-			specular = ((2*dotl) * normal.pz) - geo->light.pz;
+		if ( Specular )
+		{
+			float specular = ((2*dotl) * normal.pz) - geo->light.pz;
 			if ( specular < 0 ) specular = 0;
 			if ( texparam->specular_control == 0 ) specular = 0;
 			if ( (texparam->specular_control >> 1) != 0 ) specular *= specular;
@@ -1787,95 +1400,107 @@ void model2_state::geo_parse_nn_s( geo_state *geo, u32 *input, u32 count )
 			specular *= texparam->specular_scale;
 
 			luminance = (luminance * texparam->diffuse) + texparam->ambient + specular;
-			luma = (int32_t)luminance;
-
-			if ( luma > 255 ) luma = 255;
-			if ( luma < 0 ) luma = 0;
-
-			/* add the face bit to the luma */
-			luma += face;
-
-			/* extract distance coefficient */
-			coef = geo->coef_table[attr>>27];
-
-			/* calculate texture level of detail */
-			distance = coef * fabs( dotp ) * geo->lod;
+		}
+		else
+		{
+			luminance = (luminance * texparam->diffuse) + texparam->ambient;
+		}
+		luma = (int32_t)luminance;
 
-			/* push to the 3d rasterizer */
-			model2_3d_push( raster, luma << 15 );
-			model2_3d_push( raster, f2u(distance) >> 8 );
-			model2_3d_push( raster, f2u(point.x) >> 8 );
-			model2_3d_push( raster, f2u(point.y) >> 8 );
-			model2_3d_push( raster, f2u(point.pz) >> 8 );
+		if ( luma > 255 ) luma = 255;
+		if ( luma < 0 ) luma = 0;
 
-			/* if it's a quad, push one more point */
-			if ( attr & 1 )
-			{
-				/* read in the next point */
-				point.x = u2f( *input++ );
-				point.y = u2f( *input++ );
-				point.pz = u2f( *input++ );
+		/* add the face bit to the luma */
+		luma += face;
 
-				/* transform with the current matrix */
-				transform_point( &point, geo->matrix );
+		/* extract distance coefficient */
+		coef = geo->coef_table[attr>>27];
 
-				/* save for normal calculation */
-				p3.x = point.x; p3.y = point.y; p3.pz = point.pz;
+		/* calculate texture level of detail */
+		distance = coef * fabs( dotp ) * geo->lod;
 
-				/* apply focus */
-				apply_focus( geo, &point );
+		words[0] = attr & 0x0003FFFF;
+		words[1] = luma << 15;
+		words[2] = f2u(distance) >> 8;
+		encode_point( geo, &p2, &words[3] );
 
-				/* push to the 3d rasterizer */
-				model2_3d_push( raster, f2u(point.x) >> 8 );
-				model2_3d_push( raster, f2u(point.y) >> 8 );
-				model2_3d_push( raster, f2u(point.pz) >> 8 );
-			}
-			else
-			{
-				/* skip the next 3 points */
-				input += 3;
-
-				/* for triangles, the rope of P1(n) is achieved by P0(n-1) (linktype 3) */
-				p3.x = p2.x; p3.y = p2.y; p3.pz = p2.pz;
-			}
+		/* if it's a quad, push one more point */
+		if ( attr & 1 )
+		{
+			batch_point( geo, 3 + i * 2, &p3 );
+			encode_point( geo, &p3, &words[6] );
+			model2_3d_push_batch( raster, words, 9 );
 		}
-		else /* we're done */
+		else
 		{
-			break;
+			/* for triangles, the rope of P1(n) is achieved by P0(n-1) (linktype 3) */
+			p3 = p2;
+			model2_3d_push_batch( raster, words, 6 );
 		}
 
-		/* link type */
-		switch( (attr>>8) & 3 )
+		if ( !NormalsPresent )
 		{
-			case 0:
-			case 2:
+			/* link type */
+			switch( (attr>>8) & 3 )
 			{
-				/* reuse P0(n) and P1(n) */
-				p0.x = p2.x; p0.y = p2.y; p0.pz = p2.pz;
-				p1.x = p3.x; p1.y = p3.y; p1.pz = p3.pz;
-			}
-			break;
+				case 0:
+				case 2:
+				{
+					/* reuse P0(n) and P1(n) */
+					p0 = p2;
+					p1 = p3;
+				}
+				break;
 
-			case 1:
-			{
-				/* reuse P0(n-1) and P0(n) */
-				p1.x = p2.x; p1.y = p2.y; p1.pz = p2.pz;
-			}
-			break;
+				case 1:
+				{
+					/* reuse P0(n-1) and P0(n) */
+					p1 = p2;
+				}
+				break;
 
-			case 3:
-			{
-				/* reuse P1(n-1) and P1(n) */
-				p0.x = p3.x; p0.y = p3.y; p0.pz = p3.pz;
+				case 3:
+				{
+					/* reuse P1(n-1) and P1(n) */
+					p0 = p3;
+				}
+				break;
 			}
-			break;
 		}
 	}
 
+	/* push the attributes of the link that ended the strip */
+	if ( links < count )
+		model2_3d_push( raster, input[6 + links * 10] & 0x0003FFFF );
+
 	/* notify the 3d rasterizer we're done */
 	model2_3d_push( raster, 0 );
 }
 
+/* Parse Polygons: Normals Present, No Specular case */
+void model2_state::geo_parse_np_ns( geo_state *geo, u32 *input, u32 count )
+{
+	geo_parse_strip<true, false>( geo, input, count );
+}
+
+/* Parse Polygons: Normals Present, Specular case */
+void model2_state::geo_parse_np_s( geo_state *geo, u32 *input, u32 count )
+{
+	geo_parse_strip<true, true>( geo, input, count );
+}
+
+/* Parse Polygons: No Normals, No Specular case */
+void model2_state::geo_parse_nn_ns( geo_state *geo, u32 *input, u32 count )
+{
+	geo_parse_strip<false, false>( geo, input, count );
+}
+
+/* Parse Polygons: No Normals, Specular case */
+void model2_state::geo_parse_nn_s( geo_state *geo, u32 *input, u32 count )
+{
+	geo_parse_strip<false, true>( geo, input, count );
+}
+
 /*******************************************
  *
  *  Geometry Engine Commands
@@ -2549,6 +2174,69 @@ void model2_state::geo_parse( void )
 /***********************************************************************************************/
 
 
+/*******************************************
+ *
+ *  Decoded texture cache
+ *
+ *******************************************/
+
+void model2_texture_cache::init(u32 *sheet, u32 bytes)
+{
+	// texture RAM sizes are powers of two
+	const u32 words = bytes / 4;
+
+	m_sheet = sheet;
+	m_word_mask = words - 1;
+	m_texel_mask = (words * 8) - 1;
+	m_texels = make_unique_clear<u8[]>(words * 8);
+	m_dirty = make_unique_clear<bool[]>((words >> PAGE_SHIFT) + 1);
+	mark_all_dirty();
+}
+
+void model2_texture_cache::mark_all_dirty()
+{
+	std::fill_n(&m_dirty[0], (m_word_mask >> PAGE_SHIFT) + 1, true);
+	m_any_dirty = true;
+}
+
+void model2_texture_cache::refresh()
+{
+	if (!m_any_dirty)
+		return;
+
+	const u32 pages = (m_word_mask >> PAGE_SHIFT) + 1;
+	for (u32 page = 0; page < pages; page++)
+	{
+		if (!m_dirty[page])
+			continue;
+		m_dirty[page] = false;
+
+		// each 32-bit word holds two 16-bit words of 2x2 texels, low half first
+		const u32 start = page << PAGE_SHIFT;
+		const u32 end = std::min(start + (1 << PAGE_SHIFT), m_word_mask + 1);
+		for (u32 word = start; word < end; word++)
+		{
+			u8 *dst = &m_texels[word << 3];
+			for (int half = 0; half < 2; half++)
+			{
+				const u16 texel = m_sheet[word] >> (half * 16);
+				dst[0] = (texel >> 12) & 0x0f;  // even y, even x
+				dst[1] = (texel >> 8) & 0x0f;   // even y, odd x
+				dst[2] = (texel >> 4) & 0x0f;   // odd y, even x
+				dst[3] = (texel >> 0) & 0x0f;   // odd y, odd x
+				dst += 4;
+			}
+		}
+	}
+	m_any_dirty = false;
+}
+
+void model2_state::device_post_load()
+{
+	m_texcache[0].mark_all_dirty();
+	m_texcache[1].mark_all_dirty();
+}
+
 void model2_state::video_start()
 {
 	const rectangle &visarea = m_screen->visible_area();
@@ -2559,6 +2247,9 @@ void model2_state::video_start()
 
 	m_poly = std::make_unique<model2_renderer>(*this);
 
+	m_texcache[0].init(m_textureram0, m_textureram0.bytes());
+	m_texcache[1].init(m_textureram1, m_textureram1.bytes());
+
 	/* initialize the hardware rasterizer */
 	raster_init( memregion("textures") );
 
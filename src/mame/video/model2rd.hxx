@@ -60,7 +60,7 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 {
 #if !defined( MODEL2_TRANSLUCENT)
 	model2_state *state = object.state;
-	u32 *const p = &m_destmap.pix(scanline);
+	u32 *const p = &destmap().pix(scanline);
 //  u8  *gamma_value = &state->m_gamma_table[0];
 
 	/* extract color information */
@@ -118,7 +118,7 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_extra_data& object, int threadid)
 {
 	model2_state *state = object.state;
-	u32 *const p = &m_destmap.pix(scanline);
+	u32 *const p = &destmap().pix(scanline);
 
 	u32  tex_width = object.texwidth;
 	u32  tex_height = object.texheight;
@@ -135,7 +135,8 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 	u32  tex_x_mask, tex_y_mask;
 	u32  tex_mirr_x = object.texmirrorx;
 	u32  tex_mirr_y = object.texmirrory;
-	u32 *sheet = object.texsheet;
+	const u8 *texels = object.textexels;
+	u32  texmask = object.texmask;
 	u8  *gamma_value = &state->m_gamma_table[0];
 	float ooz = extent.param[0].start;
 	float uoz = extent.param[1].start;
@@ -178,7 +179,7 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 		if ( tex_mirr_y )
 			v2 = ( tex_height - 1 ) - v2;
 
-		t = get_texel( tex_x, tex_y, u2, v2, sheet );
+		t = get_cached_texel( tex_x, tex_y, u2, v2, texels, texmask );
 
 #if defined(MODEL2_TRANSLUCENT)
 		if ( t == 0x0f )
@@ -45,6 +45,9 @@ public:
 	{
 		m_fb = std::make_unique<bitmap_rgb32>(width, height);
 		m_zb = std::make_unique<bitmap_ind32>(width, height);
+
+		// all scanline functions interpolate depth linearly in p[0] and pass on z <= zb
+		enable_coarse_depth(width, height, DEPTH_LESS_EQUAL, 10000000000.0f);
 	}
 
 	void draw(bitmap_rgb32 &bitmap, const rectangle &cliprect);
@@ -2059,6 +2062,7 @@ void model3_renderer::clear_zb()
 
 	float zvalue = 10000000000.0f;
 	m_zb->fill(*(int*)&zvalue, cliprect);
+	clear_coarse_depth();
 }
 
 void model3_renderer::wait_for_polys()
@@ -2101,6 +2105,9 @@ void model3_renderer::draw_opaque_triangles(const m3_triangle* tris, int num_tri
 			extra.texture_param = tri->param;
 			extra.color = tri->color;
 
+			// contour texels can fail the alpha test and leave depth untouched
+			set_coarse_depth(0, !(tri->param & TRI_PARAM_ALPHA_TEST));
+
 			if (tri->param & TRI_PARAM_ALPHA_TEST)
 			{
 				render_triangle(cliprect, render_delegate(&model3_renderer::draw_scanline_tex_contour, this), 5, v[0], v[1], v[2]);
@@ -2126,6 +2133,7 @@ void model3_renderer::draw_opaque_triangles(const m3_triangle* tris, int num_tri
 			model3_polydata &extra = object_data_alloc();
 			extra.color = tri->color;
 
+			set_coarse_depth(0, true);
 			render_triangle(cliprect, render_delegate(&model3_renderer::draw_scanline_solid, this), 2, v[0], v[1], v[2]);
 		}
 	}
@@ -2143,6 +2151,9 @@ void model3_renderer::draw_alpha_triangles(const m3_triangle* tris, int num_tris
 
 	vertex_t v[3];
 
+	// translucent polygons are depth tested but never write depth
+	set_coarse_depth(0, false);
+
 	for (int t=num_tris-1; t >= 0; t--)
 	{
 		const m3_triangle* tri = &tris[t];
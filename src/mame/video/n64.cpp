@@ -29,6 +29,10 @@ TODO:
 #include "video/rdpblend.h"
 #include "video/rdptpipe.h"
 
+#include "debug/debugcon.h"
+#include "debug/debugcmd.h"
+#include "debugger.h"
+
 #include <algorithm>
 
 #define LOG_RDP_EXECUTION       0
@@ -104,6 +108,12 @@ void n64_state::video_start()
 
 	m_rdp->m_aux_buf = make_unique_clear<uint8_t[]>(EXTENT_AUX_COUNT);
 
+	if (machine().debug_flags & DEBUG_FLAG_ENABLED)
+	{
+		using namespace std::placeholders;
+		machine().debugger().console().register_command("rdp", CMDFLAG_CUSTOM_HELP, 0, 1, 3, std::bind(&n64_rdp::debug_commands, m_rdp, _1, _2));
+	}
+
 	if (LOG_RDP_EXECUTION)
 	{
 		rdp_exec = fopen("rdp_execute.txt", "wt");
@@ -1868,6 +1878,9 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	const uint32_t fifo_index = rect ? 0 : m_cmd_cur;
 	const uint64_t w1 = cmd_data[fifo_index + 0];
 
+	if (m_replaying)
+		m_replay_triangles++;
+
 	int32_t flip = int32_t(w1 >> 55) & 1;
 	m_misc_state.m_max_level = uint32_t(w1 >> 51) & 7;
 	int32_t tilenum = int32_t(w1 >> 48) & 0x7;
@@ -2151,6 +2164,10 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 				set_sub_input_alpha(&userdata->m_color_inputs.combiner_alphasub_b[1], m_combine.sub_b_a1, userdata);
 				set_mul_input_alpha(&userdata->m_color_inputs.combiner_alphamul[1], m_combine.mul_a1, userdata);
 				set_sub_input_alpha(&userdata->m_color_inputs.combiner_alphaadd[1], m_combine.add_a1, userdata);
+
+				userdata->m_color_inputs.combiner_add_only[0] = m_combine.add_only[0];
+				userdata->m_color_inputs.combiner_add_only[1] = m_combine.add_only[1];
+				userdata->m_color_inputs.combiner_noise = m_combine.noise;
 			}
 
 			if (spix == 3)
@@ -2452,6 +2469,50 @@ void n64_rdp::cmd_set_other_modes(uint64_t w1)
 	m_other_modes.alpha_dither_mode = (m_other_modes.alpha_compare_en << 1) | m_other_modes.dither_alpha_en;
 }
 
+/*
+    Texture loads read RDRAM through these so that a pin64 capture can
+    record the data, and a replayed capture can supply it instead.
+*/
+
+bool n64_rdp::replay_available(uint32_t bytes)
+{
+	// a truncated capture must not run into pin64_data_t's fatalerror
+	if (m_replay_data->offset() + bytes <= m_replay_data->size())
+		return true;
+	m_replay_short = true;
+	return false;
+}
+
+uint8_t n64_rdp::tex_read8(uint32_t addr)
+{
+	if (m_replay_data)
+		return replay_available(1) ? m_replay_data->get8() : 0;
+
+	const uint8_t data = U_RREADADDR8(addr);
+	m_capture.data_block()->put8(data);
+	return data;
+}
+
+uint16_t n64_rdp::tex_read16(uint32_t idx)
+{
+	if (m_replay_data)
+		return replay_available(2) ? m_replay_data->get16() : 0;
+
+	const uint16_t data = U_RREADIDX16(idx);
+	m_capture.data_block()->put16(data);
+	return data;
+}
+
+uint32_t n64_rdp::tex_read32(uint32_t idx)
+{
+	if (m_replay_data)
+		return replay_available(4) ? m_replay_data->get32() : 0;
+
+	const uint32_t data = U_RREADIDX32(idx);
+	m_capture.data_block()->put32(data);
+	return data;
+}
+
 void n64_rdp::cmd_load_tlut(uint64_t w1)
 {
 	//wait("LoadTLUT");
@@ -2488,8 +2549,7 @@ void n64_rdp::cmd_load_tlut(uint64_t w1)
 			{
 				if (dststart < 2048)
 				{
-					dst[dststart] = U_RREADIDX16(srcstart);
-					m_capture.data_block()->put16(dst[dststart]);
+					dst[dststart] = tex_read16(srcstart);
 					dst[dststart + 1] = dst[dststart];
 					dst[dststart + 2] = dst[dststart];
 					dst[dststart + 3] = dst[dststart];
@@ -2579,15 +2639,10 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 				int32_t ptr = tb + (i << 2);
 				int32_t srcptr = src + (i << 2);
 
-				tc[(ptr ^ t) & 0x7ff] = U_RREADIDX16(srcptr);
-				tc[((ptr + 1) ^ t) & 0x7ff] = U_RREADIDX16(srcptr + 1);
-				tc[((ptr + 2) ^ t) & 0x7ff] = U_RREADIDX16(srcptr + 2);
-				tc[((ptr + 3) ^ t) & 0x7ff] = U_RREADIDX16(srcptr + 3);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
+				tc[(ptr ^ t) & 0x7ff] = tex_read16(srcptr);
+				tc[((ptr + 1) ^ t) & 0x7ff] = tex_read16(srcptr + 1);
+				tc[((ptr + 2) ^ t) & 0x7ff] = tex_read16(srcptr + 2);
+				tc[((ptr + 3) ^ t) & 0x7ff] = tex_read16(srcptr + 3);
 
 				j += dxt;
 			}
@@ -2606,21 +2661,16 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 				int32_t ptr = ((tb + (i << 1)) ^ t) & 0x3ff;
 				int32_t srcptr = src + (i << 2);
 
-				int32_t first = U_RREADIDX16(srcptr);
-				int32_t sec = U_RREADIDX16(srcptr + 1);
+				int32_t first = tex_read16(srcptr);
+				int32_t sec = tex_read16(srcptr + 1);
 				tc[ptr] = ((first >> 8) << 8) | (sec >> 8);
 				tc[ptr | 0x400] = ((first & 0xff) << 8) | (sec & 0xff);
 
 				ptr = ((tb + (i << 1) + 1) ^ t) & 0x3ff;
-				first = U_RREADIDX16(srcptr + 2);
-				sec = U_RREADIDX16(srcptr + 3);
+				first = tex_read16(srcptr + 2);
+				sec = tex_read16(srcptr + 3);
 				tc[ptr] = ((first >> 8) << 8) | (sec >> 8);
 				tc[ptr | 0x400] = ((first & 0xff) << 8) | (sec & 0xff);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
 				j += dxt;
 			}
 		}
@@ -2635,17 +2685,12 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 
 				int32_t ptr = ((tb + (i << 1)) ^ t) & 0x3ff;
 				int32_t srcptr = src + (i << 2);
-				tc[ptr] = U_RREADIDX16(srcptr);
-				tc[ptr | 0x400] = U_RREADIDX16(srcptr + 1);
+				tc[ptr] = tex_read16(srcptr);
+				tc[ptr | 0x400] = tex_read16(srcptr + 1);
 
 				ptr = ((tb + (i << 1) + 1) ^ t) & 0x3ff;
-				tc[ptr] = U_RREADIDX16(srcptr + 2);
-				tc[ptr | 0x400] = U_RREADIDX16(srcptr + 3);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
+				tc[ptr] = tex_read16(srcptr + 2);
+				tc[ptr | 0x400] = tex_read16(srcptr + 3);
 
 				j += dxt;
 			}
@@ -2660,15 +2705,10 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 			{
 				int32_t ptr = tb + (i << 2);
 				int32_t srcptr = src + (i << 2);
-				tc[(ptr ^ WORD_ADDR_XOR) & 0x7ff] = U_RREADIDX16(srcptr);
-				tc[((ptr + 1) ^ WORD_ADDR_XOR) & 0x7ff] = U_RREADIDX16(srcptr + 1);
-				tc[((ptr + 2) ^ WORD_ADDR_XOR) & 0x7ff] = U_RREADIDX16(srcptr + 2);
-				tc[((ptr + 3) ^ WORD_ADDR_XOR) & 0x7ff] = U_RREADIDX16(srcptr + 3);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
+				tc[(ptr ^ WORD_ADDR_XOR) & 0x7ff] = tex_read16(srcptr);
+				tc[((ptr + 1) ^ WORD_ADDR_XOR) & 0x7ff] = tex_read16(srcptr + 1);
+				tc[((ptr + 2) ^ WORD_ADDR_XOR) & 0x7ff] = tex_read16(srcptr + 2);
+				tc[((ptr + 3) ^ WORD_ADDR_XOR) & 0x7ff] = tex_read16(srcptr + 3);
 			}
 		}
 		else if (tile[tilenum].format == FORMAT_YUV)
@@ -2677,21 +2717,16 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 			{
 				int32_t ptr = ((tb + (i << 1)) ^ WORD_ADDR_XOR) & 0x3ff;
 				int32_t srcptr = src + (i << 2);
-				int32_t first = U_RREADIDX16(srcptr);
-				int32_t sec = U_RREADIDX16(srcptr + 1);
+				int32_t first = tex_read16(srcptr);
+				int32_t sec = tex_read16(srcptr + 1);
 				tc[ptr] = ((first >> 8) << 8) | (sec >> 8);//UV pair
 				tc[ptr | 0x400] = ((first & 0xff) << 8) | (sec & 0xff);
 
 				ptr = ((tb + (i << 1) + 1) ^ WORD_ADDR_XOR) & 0x3ff;
-				first = U_RREADIDX16(srcptr + 2);
-				sec = U_RREADIDX16(srcptr + 3);
+				first = tex_read16(srcptr + 2);
+				sec = tex_read16(srcptr + 3);
 				tc[ptr] = ((first >> 8) << 8) | (sec >> 8);
 				tc[ptr | 0x400] = ((first & 0xff) << 8) | (sec & 0xff);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
 			}
 		}
 		else
@@ -2700,17 +2735,12 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 			{
 				int32_t ptr = ((tb + (i << 1)) ^ WORD_ADDR_XOR) & 0x3ff;
 				int32_t srcptr = src + (i << 2);
-				tc[ptr] = U_RREADIDX16(srcptr);
-				tc[ptr | 0x400] = U_RREADIDX16(srcptr + 1);
+				tc[ptr] = tex_read16(srcptr);
+				tc[ptr | 0x400] = tex_read16(srcptr + 1);
 
 				ptr = ((tb + (i << 1) + 1) ^ WORD_ADDR_XOR) & 0x3ff;
-				tc[ptr] = U_RREADIDX16(srcptr + 2);
-				tc[ptr | 0x400] = U_RREADIDX16(srcptr + 3);
-
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+1));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+2));
-				m_capture.data_block()->put16(U_RREADIDX16(srcptr+3));
+				tc[ptr] = tex_read16(srcptr + 2);
+				tc[ptr | 0x400] = tex_read16(srcptr + 3);
 			}
 		}
 		tile[tilenum].th = tl;
@@ -2771,8 +2801,7 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
 
 				for (int32_t i = 0; i < width; i++)
 				{
-					const uint8_t data = U_RREADADDR8(src + s + i);
-					m_capture.data_block()->put8(data);
+					const uint8_t data = tex_read8(src + s + i);
 					tc[((tline + i) ^ xorval8) & 0xfff] = data;
 				}
 			}
@@ -2795,8 +2824,7 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
 					for (int32_t i = 0; i < width; i++)
 					{
 						const uint32_t taddr = (tline + i) ^ xorval16;
-						const uint16_t data = U_RREADIDX16(src + s + i);
-						m_capture.data_block()->put16(data);
+						const uint16_t data = tex_read16(src + s + i);
 						tc[taddr & 0x7ff] = data;
 					}
 				}
@@ -2813,8 +2841,7 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
 					for (int32_t i = 0; i < width; i++)
 					{
 						uint32_t taddr = ((tline + i) ^ xorval8) & 0x7ff;
-						uint16_t yuvword = U_RREADIDX16(src + s + i);
-						m_capture.data_block()->put16(yuvword);
+						uint16_t yuvword = tex_read16(src + s + i);
 						get_tmem8()[taddr] = yuvword >> 8;
 						get_tmem8()[taddr | 0x800] = yuvword & 0xff;
 					}
@@ -2836,8 +2863,7 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
 				const int32_t xorval32cur = (j & 1) ? WORD_XOR_DWORD_SWAP : WORD_ADDR_XOR;
 				for (int32_t i = 0; i < width; i++)
 				{
-					uint32_t c = U_RREADIDX32(src + s + i);
-					m_capture.data_block()->put32(c);
+					uint32_t c = tex_read32(src + s + i);
 					uint32_t ptr = ((tline + i) ^ xorval32cur) & 0x3ff;
 					tc16[ptr] = c >> 16;
 					tc16[ptr | 0x400] = c & 0xffff;
@@ -2982,6 +3008,10 @@ void n64_rdp::cmd_set_combine(uint64_t w1)
 	m_combine.add_rgb1      = uint32_t(w1 >>  6) & 0x7;
 	m_combine.sub_b_a1      = uint32_t(w1 >>  3) & 0x7;
 	m_combine.add_a1        = uint32_t(w1 >>  0) & 0x7;
+
+	m_combine.add_only[0] = combiner_cycle_is_add_only(m_combine.sub_a_rgb0, m_combine.sub_b_rgb0, m_combine.mul_rgb0, m_combine.sub_a_a0, m_combine.sub_b_a0, m_combine.mul_a0);
+	m_combine.add_only[1] = combiner_cycle_is_add_only(m_combine.sub_a_rgb1, m_combine.sub_b_rgb1, m_combine.mul_rgb1, m_combine.sub_a_a1, m_combine.sub_b_a1, m_combine.mul_a1);
+	m_combine.noise = (m_combine.sub_a_rgb0 == 7) || (m_combine.sub_a_rgb1 == 7);
 }
 
 void n64_rdp::cmd_set_texture_image(uint64_t w1)
@@ -3027,6 +3057,59 @@ void n64_rdp::cmd_noop(uint64_t w1)
 }
 
 
+void n64_rdp::execute_command(uint32_t cmd, uint64_t w)
+{
+	switch(cmd)
+	{
+		case 0x00:  cmd_noop(w);           break;
+
+		case 0x08:  cmd_triangle(w);       break;
+		case 0x09:  cmd_triangle_z(w);     break;
+		case 0x0a:  cmd_triangle_t(w);     break;
+		case 0x0b:  cmd_triangle_tz(w);    break;
+		case 0x0c:  cmd_triangle_s(w);     break;
+		case 0x0d:  cmd_triangle_sz(w);    break;
+		case 0x0e:  cmd_triangle_st(w);    break;
+		case 0x0f:  cmd_triangle_stz(w);   break;
+
+		case 0x24:  cmd_tex_rect(w);       break;
+		case 0x25:  cmd_tex_rect_flip(w);  break;
+
+		case 0x26:  cmd_sync_load(w);      break;
+		case 0x27:  cmd_sync_pipe(w);      break;
+		case 0x28:  cmd_sync_tile(w);      break;
+		case 0x29:  cmd_sync_full(w);      break;
+
+		case 0x2a:  cmd_set_key_gb(w);     break;
+		case 0x2b:  cmd_set_key_r(w);      break;
+
+		case 0x2c:  cmd_set_convert(w);    break;
+		case 0x3c:  cmd_set_combine(w);    break;
+		case 0x2d:  cmd_set_scissor(w);    break;
+		case 0x2e:  cmd_set_prim_depth(w); break;
+		case 0x2f:  cmd_set_other_modes(w);break;
+
+		case 0x30:  cmd_load_tlut(w);      break;
+		case 0x33:  cmd_load_block(w);     break;
+		case 0x34:  cmd_load_tile(w);      break;
+
+		case 0x32:  cmd_set_tile_size(w);  break;
+		case 0x35:  cmd_set_tile(w);       break;
+
+		case 0x36:  cmd_fill_rect(w);      break;
+
+		case 0x37:  cmd_set_fill_color32(w); break;
+		case 0x38:  cmd_set_fog_color(w);  break;
+		case 0x39:  cmd_set_blend_color(w);break;
+		case 0x3a:  cmd_set_prim_color(w); break;
+		case 0x3b:  cmd_set_env_color(w);  break;
+
+		case 0x3d:  cmd_set_texture_image(w); break;
+		case 0x3e:  cmd_set_mask_image(w);  break;
+		case 0x3f:  cmd_set_color_image(w); break;
+	}
+}
+
 void n64_rdp::process_command_list()
 {
 	int32_t length = m_end - m_current;
@@ -3077,65 +3160,158 @@ void n64_rdp::process_command_list()
 			fflush(rdp_exec);
 		}
 
-		// execute the command
-		uint64_t w = m_cmd_data[m_cmd_cur];
+		execute_command(cmd, m_cmd_data[m_cmd_cur]);
 
-		switch(cmd)
-		{
-			case 0x00:  cmd_noop(w);           break;
+		m_cmd_cur += s_rdp_command_length[cmd] / 8;
+	};
+	m_cmd_ptr = 0;
+	m_cmd_cur = 0;
 
-			case 0x08:  cmd_triangle(w);       break;
-			case 0x09:  cmd_triangle_z(w);     break;
-			case 0x0a:  cmd_triangle_t(w);     break;
-			case 0x0b:  cmd_triangle_tz(w);    break;
-			case 0x0c:  cmd_triangle_s(w);     break;
-			case 0x0d:  cmd_triangle_sz(w);    break;
-			case 0x0e:  cmd_triangle_st(w);    break;
-			case 0x0f:  cmd_triangle_stz(w);   break;
+	m_start = m_current = m_end;
+}
 
-			case 0x24:  cmd_tex_rect(w);       break;
-			case 0x25:  cmd_tex_rect_flip(w);  break;
+/*****************************************************************************/
 
-			case 0x26:  cmd_sync_load(w);      break;
-			case 0x27:  cmd_sync_pipe(w);      break;
-			case 0x28:  cmd_sync_tile(w);      break;
-			case 0x29:  cmd_sync_full(w);      break;
+/*
+    pin64 capture replay.  Each captured command list is fed back through the
+    command dispatcher, with texture loads served from the captured data
+    blocks rather than RDRAM.  The RDP state and the target framebuffer are
+    overwritten, so this is a benchmarking and regression aid rather than
+    something to use mid-game.
+*/
 
-			case 0x2a:  cmd_set_key_gb(w);     break;
-			case 0x2b:  cmd_set_key_r(w);      break;
+void n64_rdp::replay_list(pin64_t &capture, uint32_t list)
+{
+	debugger_console &con = m_machine->debugger().console();
 
-			case 0x2c:  cmd_set_convert(w);    break;
-			case 0x3c:  cmd_set_combine(w);    break;
-			case 0x2d:  cmd_set_scissor(w);    break;
-			case 0x2e:  cmd_set_prim_depth(w); break;
-			case 0x2f:  cmd_set_other_modes(w);break;
+	for (uint32_t i = capture.list_start(list); i < capture.list_end(list); i++)
+	{
+		pin64_block_t *block = capture.command_block(i);
+		if (!block)
+			continue;
+
+		// blocks hold a word count, the command words and, for texture
+		// loads, the hash of the data block; check the size before reading
+		pin64_data_t *data = block->data();
+		data->reset();
+		if (data->size() < 4)
+		{
+			con.printf("Warning: skipping truncated command block %u\n", i);
+			continue;
+		}
 
-			case 0x30:  cmd_load_tlut(w);      break;
-			case 0x33:  cmd_load_block(w);     break;
-			case 0x34:  cmd_load_tile(w);      break;
+		const uint32_t words = data->get32();
+		if (words == 0 || words > ARRAY_LENGTH(m_cmd_data) || data->size() < 4 + words * 8)
+		{
+			con.printf("Warning: skipping bad command block %u (%u words, %u bytes)\n", i, words, data->size());
+			continue;
+		}
 
-			case 0x32:  cmd_set_tile_size(w);  break;
-			case 0x35:  cmd_set_tile(w);       break;
+		for (uint32_t w = 0; w < words; w++)
+			m_cmd_data[w] = data->get64();
 
-			case 0x36:  cmd_fill_rect(w);      break;
+		const uint32_t cmd = (m_cmd_data[0] >> 56) & 0x3f;
+		if (cmd == 0x30 || cmd == 0x33 || cmd == 0x34)
+		{
+			if (data->size() < 4 + words * 8 + 4)
+			{
+				con.printf("Warning: skipping load command block %u without a data block\n", i);
+				continue;
+			}
 
-			case 0x37:  cmd_set_fill_color32(w); break;
-			case 0x38:  cmd_set_fog_color(w);  break;
-			case 0x39:  cmd_set_blend_color(w);break;
-			case 0x3a:  cmd_set_prim_color(w); break;
-			case 0x3b:  cmd_set_env_color(w);  break;
+			pin64_block_t *load = capture.find_block(data->get32());
+			if (!load)
+				continue;
 
-			case 0x3d:  cmd_set_texture_image(w); break;
-			case 0x3e:  cmd_set_mask_image(w);  break;
-			case 0x3f:  cmd_set_color_image(w); break;
+			m_replay_data = load->data();
+			m_replay_data->reset();
 		}
 
-		m_cmd_cur += s_rdp_command_length[cmd] / 8;
-	};
+		m_cmd_cur = 0;
+		execute_command(cmd, m_cmd_data[0]);
+		m_replay_data = nullptr;
+
+		if (m_replay_short)
+		{
+			con.printf("Warning: data block for command block %u is too short, missing texels read as 0\n", i);
+			m_replay_short = false;
+		}
+	}
+
 	m_cmd_ptr = 0;
 	m_cmd_cur = 0;
+}
 
-	m_start = m_current = m_end;
+void n64_rdp::debug_commands(int ref, const std::vector<std::string> &params)
+{
+	if (params.size() < 1)
+		return;
+
+	if (params[0] == "replay")
+		debug_replay_command(ref, params);
+	else
+		debug_help_command(ref, params);
+}
+
+void n64_rdp::debug_help_command(int ref, const std::vector<std::string> &params)
+{
+	debugger_console &con = m_machine->debugger().console();
+
+	con.printf("Available N64 RDP commands:\n");
+	con.printf("  rdp replay,<filename>[,<count>] -- replay a pin64 capture <count> times and report throughput\n");
+	con.printf("  rdp help -- this list\n");
+}
+
+void n64_rdp::debug_replay_command(int ref, const std::vector<std::string> &params)
+{
+	debugger_console &con = m_machine->debugger().console();
+
+	if (params.size() < 2)
+	{
+		con.printf("Error: not enough parameters for rdp replay command\n");
+		return;
+	}
+
+	u64 count = 1;
+	if (params.size() > 2 && !m_machine->debugger().commands().validate_number_parameter(params[2], count))
+		return;
+
+	pin64_t capture;
+	if (!capture.load(params[1].c_str()))
+	{
+		con.printf("Error: unable to load pin64 capture %s\n", params[1].c_str());
+		return;
+	}
+
+	wait("replay");
+	m_replaying = true;
+	m_replay_triangles = 0;
+	m_replay_pixels = 0;
+
+	const osd_ticks_t start = osd_ticks();
+	for (u64 pass = 0; pass < count; pass++)
+		for (uint32_t list = 0; list < capture.lists(); list++)
+			replay_list(capture, list);
+	wait("replay");
+	const osd_ticks_t elapsed = std::max<osd_ticks_t>(osd_ticks() - start, 1);
+
+	m_replaying = false;
+
+	const double seconds = double(elapsed) / double(osd_ticks_per_second());
+	con.printf("Replayed %u command lists %u times in %.3f ms\n", capture.lists(), uint32_t(count), seconds * 1000.0);
+	con.printf("  %u triangles (%.0f/s), %u pixels (%.0f/s)\n",
+			m_replay_triangles, double(m_replay_triangles) / seconds,
+			uint32_t(m_replay_pixels), double(m_replay_pixels) / seconds);
+
+	// hash the last color image over the scissored height
+	const uint32_t fb_address = m_misc_state.m_fb_address & 0x007fffff;
+	uint32_t fb_bytes = 0;
+	if (m_misc_state.m_fb_size != 0)
+		fb_bytes = (m_misc_state.m_fb_width * (m_scissor.m_yl >> 2)) << (m_misc_state.m_fb_size - 1);
+	fb_bytes = std::min<uint32_t>(fb_bytes, 0x00800000 - fb_address);
+
+	const util::crc32_t crc = util::crc32_creator::simple((uint8_t *)m_rdram + fb_address, fb_bytes);
+	con.printf("  framebuffer %08x, %u bytes, CRC32 %08x\n", fb_address, fb_bytes, uint32_t(crc));
 }
 
 /*****************************************************************************/
@@ -3175,6 +3351,12 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_prim_lod_fraction.set(0, 0, 0, 0);
 	z_build_com_table();
 
+	set_statistics_name("rdp");
+	set_mode_name(render_delegate(&n64_rdp::span_draw_1cycle, this), "1cycle");
+	set_mode_name(render_delegate(&n64_rdp::span_draw_2cycle, this), "2cycle");
+	set_mode_name(render_delegate(&n64_rdp::span_draw_copy, this), "copy");
+	set_mode_name(render_delegate(&n64_rdp::span_draw_fill, this), "fill");
+
 	memset(m_temp_rect_data, 0, sizeof(uint32_t) * 0x1000);
 
 	for (int32_t i = 0; i < 0x4000; i++)
@@ -3249,6 +3431,12 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 		end = clipy2 - 1;
 	}
 
+	if (m_replaying)
+	{
+		for (int32_t i = 0; i <= end - start; i++)
+			m_replay_pixels += std::abs(spans[offset + i].stopx - spans[offset + i].startx) + 1;
+	}
+
 	object->m_rdp = this;
 	memcpy(&object->m_misc_state, &m_misc_state, sizeof(misc_state_t));
 	memcpy(&object->m_other_modes, &m_other_modes, sizeof(other_modes_t));
@@ -3508,6 +3696,60 @@ inline void n64_rdp::fill_pixel(uint32_t curpixel, const rdp_poly_state &object)
 	}
 }
 
+/*
+    The combiner evaluates (A - B) * C + D per cycle.  When A and B select the
+    same input, or C selects zero, for both the color and alpha equations,
+    the product term vanishes and the rounded result is exactly D, so the
+    subtract/multiply stages can be skipped.  The classification is made
+    once in cmd_set_combine rather than per pixel.
+*/
+
+bool n64_rdp::combiner_cycle_is_add_only(int32_t sub_a_rgb, int32_t sub_b_rgb, int32_t mul_rgb, int32_t sub_a_a, int32_t sub_b_a, int32_t mul_a)
+{
+	// sub A 6 and 7 (one, noise) and sub B 6 and 7 (key center, K4) do not coincide
+	const bool rgb_zero_diff = (sub_a_rgb == sub_b_rgb && sub_a_rgb < 6) || (sub_a_rgb >= 8 && sub_b_rgb >= 8);
+	const bool rgb_zero_mul = (mul_rgb >= 16);
+	const bool alpha_zero_diff = (sub_a_a == sub_b_a);
+	const bool alpha_zero_mul = (mul_a == 7);
+	return (rgb_zero_diff || rgb_zero_mul) && (alpha_zero_diff || alpha_zero_mul);
+}
+
+inline void n64_rdp::combine_cycle(rgbaint_t &out, int32_t cycle, rdp_span_aux* userdata)
+{
+	const color_inputs_t &inputs = userdata->m_color_inputs;
+
+	if (inputs.combiner_add_only[cycle])
+	{
+		out.set(*inputs.combiner_rgbadd[cycle]);
+		out.merge_alpha(*inputs.combiner_alphaadd[cycle]);
+		out.sign_extend(0x180, 0xfffffe00);
+		out.clamp_and_clear(0xfffffe00);
+		return;
+	}
+
+	rgbaint_t rgbsub_b(*inputs.combiner_rgbsub_b[cycle]);
+	rgbaint_t rgbmul(*inputs.combiner_rgbmul[cycle]);
+	rgbaint_t rgbadd(*inputs.combiner_rgbadd[cycle]);
+	out.set(*inputs.combiner_rgbsub_a[cycle]);
+
+	out.merge_alpha(*inputs.combiner_alphasub_a[cycle]);
+	rgbsub_b.merge_alpha(*inputs.combiner_alphasub_b[cycle]);
+	rgbmul.merge_alpha(*inputs.combiner_alphamul[cycle]);
+	rgbadd.merge_alpha(*inputs.combiner_alphaadd[cycle]);
+
+	out.sign_extend(0x180, 0xfffffe00);
+	rgbsub_b.sign_extend(0x180, 0xfffffe00);
+	rgbadd.sign_extend(0x180, 0xfffffe00);
+
+	rgbadd.shl_imm(8);
+	out.sub(rgbsub_b);
+	out.mul(rgbmul);
+	out.add(rgbadd);
+	out.add_imm(0x0080);
+	out.sra_imm(8);
+	out.clamp_and_clear(0xfffffe00);
+}
+
 void n64_rdp::span_draw_1cycle(int32_t scanline, const extent_t &extent, const rdp_poly_state &object, int32_t threadid)
 {
 	assert(object.m_misc_state.m_fb_size >= 2 && object.m_misc_state.m_fb_size < 4);
@@ -3634,32 +3876,16 @@ void n64_rdp::span_draw_1cycle(int32_t scanline, const extent_t &extent, const r
 			uint32_t t0a = userdata->m_texel0_color.get_a();
 			userdata->m_texel0_alpha.set(t0a, t0a, t0a, t0a);
 
+			// draw the random number even when the combiner ignores it, so the
+			// machine's random sequence doesn't depend on the combine mode
 			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
-
-			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[1]);
-			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[1]);
-			rgbaint_t rgbmul(*userdata->m_color_inputs.combiner_rgbmul[1]);
-			rgbaint_t rgbadd(*userdata->m_color_inputs.combiner_rgbadd[1]);
+			if (userdata->m_color_inputs.combiner_noise)
+				userdata->m_noise_color.set(0, noise, noise, noise);
 
-			rgbsub_a.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_a[1]);
-			rgbsub_b.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_b[1]);
-			rgbmul.merge_alpha(*userdata->m_color_inputs.combiner_alphamul[1]);
-			rgbadd.merge_alpha(*userdata->m_color_inputs.combiner_alphaadd[1]);
+			rgbaint_t combined;
+			combine_cycle(combined, 1, userdata);
 
-			rgbsub_a.sign_extend(0x180, 0xfffffe00);
-			rgbsub_b.sign_extend(0x180, 0xfffffe00);
-			rgbadd.sign_extend(0x180, 0xfffffe00);
-
-			rgbadd.shl_imm(8);
-			rgbsub_a.sub(rgbsub_b);
-			rgbsub_a.mul(rgbmul);
-			rgbsub_a.add(rgbadd);
-			rgbsub_a.add_imm(0x0080);
-			rgbsub_a.sra_imm(8);
-			rgbsub_a.clamp_and_clear(0xfffffe00);
-
-			userdata->m_pixel_color = rgbsub_a;
+			userdata->m_pixel_color = combined;
 
 			//Alpha coverage combiner
 			userdata->m_pixel_color.set_a(get_alpha_cvg(userdata->m_pixel_color.get_a(), userdata, object));
@@ -3861,33 +4087,15 @@ void n64_rdp::span_draw_2cycle(int32_t scanline, const extent_t &extent, const r
 			userdata->m_texel1_alpha.set(t1a, t1a, t1a, t1a);
 			userdata->m_next_texel_alpha.set(tna, tna, tna, tna);
 
+			// always drawn, see span_draw_1cycle
 			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
-
-			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[0]);
-			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[0]);
-			rgbaint_t rgbmul(*userdata->m_color_inputs.combiner_rgbmul[0]);
-			rgbaint_t rgbadd(*userdata->m_color_inputs.combiner_rgbadd[0]);
-
-			rgbsub_a.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_a[0]);
-			rgbsub_b.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_b[0]);
-			rgbmul.merge_alpha(*userdata->m_color_inputs.combiner_alphamul[0]);
-			rgbadd.merge_alpha(*userdata->m_color_inputs.combiner_alphaadd[0]);
+			if (userdata->m_color_inputs.combiner_noise)
+				userdata->m_noise_color.set(0, noise, noise, noise);
 
-			rgbsub_a.sign_extend(0x180, 0xfffffe00);
-			rgbsub_b.sign_extend(0x180, 0xfffffe00);
-			rgbadd.sign_extend(0x180, 0xfffffe00);
+			rgbaint_t combined;
+			combine_cycle(combined, 0, userdata);
 
-			rgbadd.shl_imm(8);
-			rgbsub_a.sub(rgbsub_b);
-			rgbsub_a.mul(rgbmul);
-
-			rgbsub_a.add(rgbadd);
-			rgbsub_a.add_imm(0x0080);
-			rgbsub_a.sra_imm(8);
-			rgbsub_a.clamp_and_clear(0xfffffe00);
-
-			userdata->m_combined_color.set(rgbsub_a);
+			userdata->m_combined_color.set(combined);
 			userdata->m_texel0_color.set(userdata->m_texel1_color);
 			userdata->m_texel1_color.set(userdata->m_next_texel_color);
 
@@ -3896,29 +4104,9 @@ void n64_rdp::span_draw_2cycle(int32_t scanline, const extent_t &extent, const r
 			userdata->m_texel0_alpha.set(userdata->m_texel1_alpha);
 			userdata->m_texel1_alpha.set(userdata->m_next_texel_alpha);
 
-			rgbsub_a.set(*userdata->m_color_inputs.combiner_rgbsub_a[1]);
-			rgbsub_b.set(*userdata->m_color_inputs.combiner_rgbsub_b[1]);
-			rgbmul.set(*userdata->m_color_inputs.combiner_rgbmul[1]);
-			rgbadd.set(*userdata->m_color_inputs.combiner_rgbadd[1]);
-
-			rgbsub_a.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_a[1]);
-			rgbsub_b.merge_alpha(*userdata->m_color_inputs.combiner_alphasub_b[1]);
-			rgbmul.merge_alpha(*userdata->m_color_inputs.combiner_alphamul[1]);
-			rgbadd.merge_alpha(*userdata->m_color_inputs.combiner_alphaadd[1]);
-
-			rgbsub_a.sign_extend(0x180, 0xfffffe00);
-			rgbsub_b.sign_extend(0x180, 0xfffffe00);
-			rgbadd.sign_extend(0x180, 0xfffffe00);
-
-			rgbadd.shl_imm(8);
-			rgbsub_a.sub(rgbsub_b);
-			rgbsub_a.mul(rgbmul);
-			rgbsub_a.add(rgbadd);
-			rgbsub_a.add_imm(0x0080);
-			rgbsub_a.sra_imm(8);
-			rgbsub_a.clamp_and_clear(0xfffffe00);
-
-			userdata->m_pixel_color.set(rgbsub_a);
+			combine_cycle(combined, 1, userdata);
+
+			userdata->m_pixel_color.set(combined);
 
 			//Alpha coverage combiner
 			userdata->m_pixel_color.set_a(get_alpha_cvg(userdata->m_pixel_color.get_a(), userdata, object));
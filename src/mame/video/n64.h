@@ -153,6 +153,13 @@ public:
 
 		memset(m_tiles, 0, 8 * sizeof(n64_tile_t));
 		memset(m_cmd_data, 0, sizeof(m_cmd_data));
+		memset(&m_combine, 0, sizeof(m_combine));
+
+		m_replay_data = nullptr;
+		m_replay_short = false;
+		m_replaying = false;
+		m_replay_triangles = 0;
+		m_replay_pixels = 0;
 
 		for (int32_t i = 0; i < 8; i++)
 		{
@@ -163,6 +170,9 @@ public:
 	}
 
 	void        process_command_list();
+	void        execute_command(uint32_t cmd, uint64_t w);
+	void        replay_list(pin64_t &capture, uint32_t list);
+	void        debug_commands(int ref, const std::vector<std::string> &params);
 	uint64_t      read_data(uint32_t address);
 	void        disassemble(char* buffer);
 
@@ -215,6 +225,8 @@ public:
 	void            tc_div_no_perspective(int32_t ss, int32_t st, int32_t sw, int32_t* sss, int32_t* sst);
 	uint32_t          get_log2(uint32_t lod_clamp);
 	void            render_spans(int32_t start, int32_t end, int32_t tilenum, bool flip, extent_t* spans, bool rect, rdp_poly_state* object);
+	static bool     combiner_cycle_is_add_only(int32_t sub_a_rgb, int32_t sub_b_rgb, int32_t mul_rgb, int32_t sub_a_a, int32_t sub_b_a, int32_t mul_a);
+	void            combine_cycle(rgbaint_t &out, int32_t cycle, rdp_span_aux* userdata);
 	int32_t           get_alpha_cvg(int32_t comb_alpha, rdp_span_aux* userdata, const rdp_poly_state &object);
 
 	void            z_store(const rdp_poly_state &object, uint32_t zcurpixel, uint32_t dzcurpixel, uint32_t z, uint32_t enc);
@@ -373,6 +385,20 @@ private:
 
 	pin64_t m_capture;
 
+	// capture replay
+	void        debug_help_command(int ref, const std::vector<std::string> &params);
+	void        debug_replay_command(int ref, const std::vector<std::string> &params);
+	uint8_t       tex_read8(uint32_t addr);
+	uint16_t      tex_read16(uint32_t idx);
+	uint32_t      tex_read32(uint32_t idx);
+	bool          replay_available(uint32_t bytes);
+
+	pin64_data_t* m_replay_data;
+	bool          m_replay_short;
+	bool          m_replaying;
+	uint32_t      m_replay_triangles;
+	uint64_t      m_replay_pixels;
+
 	static uint32_t s_special_9bit_clamptable[512];
 	static z_decompress_entry_t const m_z_dec_table[8];
 
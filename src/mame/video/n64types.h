@@ -169,6 +169,10 @@ struct combine_modes_t
 	int32_t sub_b_a1;
 	int32_t mul_a1;
 	int32_t add_a1;
+
+	// derived at SET_COMBINE time
+	bool add_only[2];                   // (A - B) * C term is always zero
+	bool noise;                         // noise is selected by either cycle
 };
 
 struct color_inputs_t
@@ -189,6 +193,10 @@ struct color_inputs_t
 	color_t* blender1b_a[2];
 	color_t* blender2a_rgb[2];
 	color_t* blender2b_a[2];
+
+	// combiner fast path selection
+	bool combiner_add_only[2];
+	bool combiner_noise;
 };
 
 struct other_modes_t
@@ -32,6 +32,19 @@ void pin64_fileutil_t::write(FILE* file, const uint8_t* data, uint32_t size) {
 	fwrite(data, 1, size, file);
 }
 
+bool pin64_fileutil_t::read(FILE* file, uint32_t& data) {
+	uint8_t temp[4];
+	if (fread(temp, 1, 4, file) != 4)
+		return false;
+
+	data = (uint32_t(temp[0]) << 24) | (uint32_t(temp[1]) << 16) | (uint32_t(temp[2]) << 8) | temp[3];
+	return true;
+}
+
+bool pin64_fileutil_t::read(FILE* file, uint8_t* data, uint32_t size) {
+	return fread(data, 1, size, file) == size;
+}
+
 
 
 // pin64_data_t members
@@ -218,6 +231,25 @@ void pin64_block_t::write(FILE* file) {
 		pin64_fileutil_t::write(file, m_data.bytes(), m_data.size());
 }
 
+bool pin64_block_t::read(FILE* file) {
+	uint32_t crc;
+	uint32_t size;
+	if (!pin64_fileutil_t::read(file, crc) || !pin64_fileutil_t::read(file, size))
+		return false;
+
+	m_data.clear();
+	for (uint32_t i = 0; i < size; i++) {
+		uint8_t temp;
+		if (!pin64_fileutil_t::read(file, &temp, 1))
+			return false;
+		m_data.put8(temp);
+	}
+	m_data.reset();
+
+	m_crc32 = crc;
+	return true;
+}
+
 uint32_t pin64_block_t::size() {
 	return sizeof(uint32_t) // data CRC32
 		 + sizeof(uint32_t) // data size
@@ -278,6 +310,67 @@ void pin64_t::finalize() {
 void pin64_t::play(int index) {
 }
 
+bool pin64_t::load(const char* filename) {
+	if (m_capture_file)
+		fatalerror("PIN64: Call to load() while capturing\n");
+
+	clear();
+
+	FILE* file = fopen(filename, "rb");
+	if (!file)
+		return false;
+
+	// the directories are rebuilt from the data that follows them,
+	// so only their entry counts are needed
+	uint8_t id[8];
+	uint32_t header[5];
+	uint32_t count = 0;
+	bool ok = pin64_fileutil_t::read(file, id, 8) && !memcmp(id, CAP_ID, 8);
+	for (int i = 0; ok && i < 5; i++)
+		ok = pin64_fileutil_t::read(file, header[i]);
+
+	uint32_t block_count = 0;
+	ok = ok && pin64_fileutil_t::read(file, block_count);
+	for (uint32_t i = 0; ok && i < block_count; i++)
+		ok = pin64_fileutil_t::read(file, count);
+
+	ok = ok && pin64_fileutil_t::read(file, count);
+	for (uint32_t i = 0; ok && i < count; i++) {
+		uint32_t frame;
+		ok = pin64_fileutil_t::read(file, frame);
+		m_frames.push_back(frame);
+	}
+
+	for (uint32_t i = 0; ok && i < block_count; i++) {
+		pin64_block_t* block = new pin64_block_t();
+		ok = block->read(file);
+		if (ok && m_blocks.find(block->crc32()) == m_blocks.end())
+			m_blocks[block->crc32()] = block;
+		else
+			delete block;
+	}
+
+	ok = ok && pin64_fileutil_t::read(file, count);
+	for (uint32_t i = 0; ok && i < count; i++) {
+		uint32_t crc;
+		ok = pin64_fileutil_t::read(file, crc) && m_blocks.find(crc) != m_blocks.end();
+		m_commands.push_back(crc);
+	}
+
+	fclose(file);
+
+	if (!ok)
+		clear();
+
+	m_playing = ok;
+	return ok;
+}
+
+pin64_block_t* pin64_t::find_block(util::crc32_t crc) {
+	auto found = m_blocks.find(crc);
+	return (found != m_blocks.end()) ? found->second : nullptr;
+}
+
 void pin64_t::mark_frame(running_machine& machine) {
 	if (m_capture_file) {
 		if (m_frames.size() == m_capture_frames && m_capture_frames > 0) {
@@ -328,6 +421,7 @@ void pin64_t::finish_command() {
 		m_blocks[m_current_command->crc32()] = m_current_command;
 
 	m_commands.push_back(m_current_command->crc32());
+	m_current_command = nullptr;
 }
 
 void pin64_t::data_begin() {
@@ -362,7 +456,7 @@ void pin64_t::data_end() {
 }
 
 size_t pin64_t::size() {
-	return header_size() + block_directory_size() + cmdlist_directory_size() + cmdlist_size();
+	return header_size() + block_directory_size() + cmdlist_directory_size() + blocks_size() + cmdlist_size();
 }
 
 size_t pin64_t::header_size() {
@@ -379,7 +473,7 @@ size_t pin64_t::block_directory_size() {
 }
 
 size_t pin64_t::cmdlist_directory_size() {
-	return (m_frames.size() + 1) * sizeof(uint16_t);
+	return (m_frames.size() + 1) * sizeof(uint32_t);
 }
 
 size_t pin64_t::blocks_size() {
@@ -484,6 +578,7 @@ void pin64_t::clear() {
 
 	m_current_data = nullptr;
 	m_current_command = nullptr;
+	m_playing = false;
 }
 
 void pin64_t::init_capture_index()
@@ -17,6 +17,8 @@ class pin64_fileutil_t {
 public:
 	static void write(FILE* file, uint32_t data);
 	static void write(FILE* file, const uint8_t* data, uint32_t size);
+	static bool read(FILE* file, uint32_t& data);
+	static bool read(FILE* file, uint8_t* data, uint32_t size);
 };
 
 class pin64_command_t {
@@ -91,6 +93,7 @@ public:
 	void clear();
 
 	void write(FILE* file);
+	bool read(FILE* file);
 
 	// getters
 	uint32_t size();
@@ -129,6 +132,14 @@ public:
 	void mark_frame(running_machine& machine);
 	void play(int index);
 
+	// replay
+	bool load(const char* filename);
+	uint32_t lists() const { return m_frames.size(); }
+	uint32_t list_start(uint32_t index) const { return m_frames[index]; }
+	uint32_t list_end(uint32_t index) const { return (index + 1 < m_frames.size()) ? m_frames[index + 1] : m_commands.size(); }
+	pin64_block_t* command_block(uint32_t index) { return find_block(m_commands[index]); }
+	pin64_block_t* find_block(util::crc32_t crc);
+
 	void command(uint64_t* cmd_data, uint32_t size);
 
 	void data_begin();
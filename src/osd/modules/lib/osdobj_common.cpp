@@ -559,6 +559,21 @@ void osd_common_t::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  audio_buffer_level - report how full the host
+//  audio buffer is relative to its target
+//-------------------------------------------------
+
+float osd_common_t::audio_buffer_level()
+{
+	//
+	// 1.0 means the sound module holds exactly its target amount of
+	// queued audio; a negative value means the module can't tell.
+	//
+	return (m_sound != nullptr) ? m_sound->buffer_level() : -1.0f;
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
@@ -47,6 +47,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual float buffer_level() override;
 
 private:
 	// Lock free SPSC ring buffer
@@ -424,6 +425,15 @@ void sound_pa::set_mastervolume(int attenuation)
 	m_attenuation = attenuation;
 }
 
+float sound_pa::buffer_level()
+{
+	// the skip logic above settles the buffer at half the threshold
+	if (!sample_rate() || !m_osd_ticks)
+		return -1.0f;
+
+	return m_ab->count() / (m_skip_threshold / 2.0f);
+}
+
 void sound_pa::exit()
 {
 	if (!sample_rate())
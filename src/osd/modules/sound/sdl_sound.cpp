@@ -59,6 +59,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual float buffer_level() override;
 
 private:
 	class ring_buffer
@@ -295,6 +296,22 @@ void sound_sdl::set_mastervolume(int _attenuation)
 	}
 }
 
+//============================================================
+//  buffer_level
+//============================================================
+
+float sound_sdl::buffer_level()
+{
+	if (!stream_in_initialized || !stream_buffer)
+		return -1.0f;
+
+	// the stream starts out half full, so that is the target
+	lock_buffer();
+	size_t const data_size = stream_buffer->data_size();
+	unlock_buffer();
+	return data_size / (stream_buffer_size / 2.0f);
+}
+
 //============================================================
 //  sdl_callback
 //============================================================
@@ -27,6 +27,9 @@ public:
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 
+	// buffered audio relative to the module's target fill (1.0 = on target), negative if unknown
+	virtual float buffer_level() { return -1.0f; }
+
 	int sample_rate() const { return m_sample_rate; }
 
 	int m_sample_rate;
@@ -190,6 +190,8 @@ using util::BIT;
 #include "corestr.h"
 #include "eminline.h"
 
+#include <zlib.h>
+
 #include <algorithm>
 #include <cstring>
 #include <iostream>
@@ -338,6 +340,10 @@ struct options
 	const dasm_table_entry *dasm;
 	uint32_t                skip;
 	uint32_t                count;
+	uint8_t                 trace;
+	uint8_t                 pcrange;
+	offs_t                  pcstart;
+	offs_t                  pcend;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -1049,6 +1055,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_mode = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_pcrange = false;
 
 	memset(opts, 0, sizeof(*opts));
 
@@ -1058,7 +1065,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 
 		// is it a switch?
 		if(curarg[0] == '-') {
-			if(pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+			if(pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_pcrange)
 				goto usage;
 
 			if(tolower((uint8_t)curarg[1]) == 'a')
@@ -1077,6 +1084,10 @@ static int parse_options(int argc, char *argv[], options *opts)
 				pending_count = true;
 			else if(tolower((uint8_t)curarg[1]) == 'n')
 				opts->norawbytes = true;
+			else if(tolower((uint8_t)curarg[1]) == 'p')
+				pending_pcrange = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
 			else if(tolower((uint8_t)curarg[1]) == 'u')
 				opts->upper = true;
 			else if(tolower((uint8_t)curarg[1]) == 'x')
@@ -1139,6 +1150,14 @@ static int parse_options(int argc, char *argv[], options *opts)
 			pending_count = false;
 		}
 
+		// pc range for traces
+		else if(pending_pcrange) {
+			if(sscanf(curarg, "%x-%x", &opts->pcstart, &opts->pcend) != 2)
+				goto usage;
+			opts->pcrange = true;
+			pending_pcrange = false;
+		}
+
 		// filename
 		else if(opts->filename == nullptr)
 			opts->filename = curarg;
@@ -1149,7 +1168,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if(pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+	if(pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_pcrange)
 		goto usage;
 
 	// if no file or no architecture, fail
@@ -1161,6 +1180,10 @@ usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
 	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   [-trace [-pcrange <start>-<end>]]\n");
+	printf("\n");
+	printf("With -trace, <filename> is a binary trace written by the debugger 'trace' command;\n");
+	printf("-skip and -count then apply to traced instructions.\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1180,6 +1203,225 @@ usage:
 };
 
 
+static int disassemble_trace(const options &opts, util::disasm_interface *disasm, const u8 *file, u32 length)
+{
+	namespace tf = util::trace_format;
+
+	u32 flags = disasm->interface_flags();
+	if(flags & util::disasm_interface::NONLINEAR_PC) {
+		fprintf(stderr, "Traces are not supported for architecture '%s'\n", opts.dasm->name);
+		return 1;
+	}
+
+	// Opcode data in the trace is made of little-endian units, the buffers want the architecture's byte order
+	offs_t unit = opts.dasm->pcshift < 0 ? 1 << -opts.dasm->pcshift : opts.dasm->pcshift == 3 ? 2 : 1;
+	bool swap = opts.dasm->endian == be && unit > 1;
+	auto fill = [unit, swap](unidasm_data_buffer &buffer, offs_t pc, const u8 *src, u32 size) {
+		buffer.base_pc = pc;
+		buffer.size = size;
+		buffer.data.assign(size + 8, 0x00);
+		for(u32 i = 0; i != size; i++)
+			buffer.data[i] = src[swap ? i ^ (unit - 1) : i];
+	};
+	unidasm_data_buffer opcodes(disasm, opts.dasm), params(disasm, opts.dasm);
+
+	offs_t granularity = opts.dasm->pcshift < 0 ? disasm->opcode_alignment() << -opts.dasm->pcshift : disasm->opcode_alignment() >> opts.dasm->pcshift;
+	u32 granularity_shift = 31 - count_leading_zeros(disasm->opcode_alignment());
+
+	auto transform = [&opts](std::string str) -> std::string {
+		if(opts.lower)
+			std::transform(str.begin(), str.end(), str.begin(), [](char c) { return tolower(c); });
+		else if(opts.upper)
+			std::transform(str.begin(), str.end(), str.begin(), [](char c) { return toupper(c); });
+		return str;
+	};
+
+	// Little-endian readers over the current chunk or block
+	const u8 *ptr = nullptr, *end = nullptr;
+	auto need = [&ptr, &end](size_t size) { return size_t(end - ptr) >= size; };
+	auto r8 = [&ptr]() -> u8 { return *ptr++; };
+	auto r16 = [&ptr]() -> u16 { u16 r = ptr[0] | (ptr[1] << 8); ptr += 2; return r; };
+	auto r32 = [&ptr]() -> u32 { u32 r = ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (u32(ptr[3]) << 24); ptr += 4; return r; };
+	auto r64 = [&r32]() -> u64 { u64 r = r32(); return r | (u64(r32()) << 32); };
+	auto rstr = [&ptr, &end]() -> std::string {
+		if(ptr == end)
+			return std::string();
+		u8 size = *ptr++;
+		if(size > end - ptr)
+			size = end - ptr;
+		std::string r(reinterpret_cast<const char *>(ptr), size);
+		ptr += size;
+		return r;
+	};
+
+	auto truncated = []() {
+		fprintf(stderr, "Truncated trace record\n");
+		return 1;
+	};
+
+	std::vector<std::string> registers, spaces;
+	std::vector<u8> block;
+	int pcchars = 8;
+	u64 index = 0;
+	bool shown = true;
+	const u8 *pos = file, *fileend = file + length;
+	while(fileend - pos >= 8) {
+		u32 tag = pos[0] | (pos[1] << 8) | (pos[2] << 16) | (u32(pos[3]) << 24);
+		u32 size = pos[4] | (pos[5] << 8) | (pos[6] << 16) | (u32(pos[7]) << 24);
+		pos += 8;
+		if(size > fileend - pos) {
+			fprintf(stderr, "Truncated trace chunk\n");
+			return 1;
+		}
+		ptr = pos;
+		end = pos + size;
+		pos += size;
+
+		if(tag == tf::CHUNK_HEADER) {
+			if(!need(9) || r8() != tf::VERSION) {
+				fprintf(stderr, "Unsupported trace version\n");
+				return 1;
+			}
+			int8_t addr_shift = r8();
+			r8();
+			r8();
+			u32 addrmask = r32();
+			r8();
+			std::string tag = rstr();
+			std::string shortname = rstr();
+			if(addr_shift != opts.dasm->pcshift)
+				fprintf(stderr, "Warning: trace of '%s' (%s) has address shift %d, architecture '%s' expects %d\n", tag.c_str(), shortname.c_str(), addr_shift, opts.dasm->name, opts.dasm->pcshift);
+			pcchars = (32 - count_leading_zeros(addrmask) + 3) / 4;
+			registers.clear();
+			spaces.clear();
+			for(u16 count = need(2) ? r16() : 0; count != 0; count--)
+				registers.push_back(rstr());
+			for(u8 count = need(1) ? r8() : 0; count != 0; count--)
+				spaces.push_back(rstr());
+			util::stream_format(std::cout, "; trace of %s (%s)\n", tag, shortname);
+			continue;
+		}
+
+		if(tag != tf::CHUNK_DATA || !need(4)) {
+			fprintf(stderr, "Unknown trace chunk\n");
+			return 1;
+		}
+
+		// Expand the block
+		uLongf expanded = r32();
+		block.resize(expanded);
+		if(uncompress(block.data(), &expanded, ptr, end - ptr) != Z_OK || expanded != block.size()) {
+			fprintf(stderr, "Corrupt trace block\n");
+			return 1;
+		}
+		ptr = block.data();
+		end = ptr + block.size();
+
+		while(ptr != end) {
+			switch(r8()) {
+			case tf::INSTRUCTION: {
+				if(!need(5))
+					return truncated();
+				offs_t pc = r32();
+				u8 opsize = r8();
+				if(!need(opsize + 1))
+					return truncated();
+				const u8 *opdata = ptr;
+				ptr += opsize;
+				u8 parsize = r8();
+				if(!need(parsize))
+					return truncated();
+				const u8 *pardata = ptr;
+				ptr += parsize;
+
+				shown = index >= opts.skip && (!opts.pcrange || (pc >= opts.pcstart && pc <= opts.pcend));
+				index++;
+				if(opts.count && index > u64(opts.skip) + opts.count)
+					return 0;
+				if(!shown)
+					break;
+
+				fill(opcodes, pc, opdata, opsize);
+				if(parsize)
+					fill(params, pc, pardata, parsize);
+				std::ostringstream stream;
+				offs_t result = disasm->disassemble(stream, pc, opcodes, parsize ? params : opcodes);
+				offs_t len = result & util::disasm_interface::LENGTHMASK;
+
+				if(opts.norawbytes)
+					util::stream_format(std::cout, "%0*x: %s\n", pcchars, pc, transform(stream.str()));
+				else {
+					std::string raw;
+					offs_t rawpc = pc;
+					for(offs_t i = 0; i != len >> granularity_shift; i++) {
+						if(i)
+							raw += ' ';
+						switch(granularity) {
+						case 1: raw += util::string_format("%02x", opcodes.r8(rawpc)); break;
+						case 2: raw += util::string_format("%04x", opcodes.r16(rawpc)); break;
+						case 4: raw += util::string_format("%08x", opcodes.r32(rawpc)); break;
+						case 8: raw += util::string_format("%016x", opcodes.r64(rawpc)); break;
+						}
+						rawpc += disasm->opcode_alignment();
+					}
+					util::stream_format(std::cout, "%0*x: %-23s  %s\n", pcchars, pc, transform(raw), transform(stream.str()));
+				}
+				break;
+			}
+
+			case tf::REGISTERS: {
+				if(!need(2))
+					return truncated();
+				u16 count = r16();
+				if(!need(count * 10))
+					return truncated();
+				std::string line;
+				for(; count != 0; count--) {
+					u16 reg = r16();
+					u64 value = r64();
+					line += util::string_format(" %s=%x", reg < registers.size() ? registers[reg] : util::string_format("r%d", reg), value);
+				}
+				if(shown)
+					util::stream_format(std::cout, "    ;%s\n", line);
+				break;
+			}
+
+			case tf::MEMORY_READ:
+			case tf::MEMORY_WRITE: {
+				if(!need(21))
+					return truncated();
+				bool write = ptr[-1] == tf::MEMORY_WRITE;
+				u8 spacenum = r8();
+				offs_t address = r32();
+				u64 data = r64();
+				u64 mem_mask = r64();
+				if(shown)
+					util::stream_format(std::cout, "    ; %s %s %x = %x & %x\n", write ? "W" : "R", spacenum < spaces.size() ? spaces[spacenum] : util::string_format("space%d", spacenum), address, data, mem_mask);
+				break;
+			}
+
+			case tf::TEXT: {
+				if(!need(2))
+					return truncated();
+				u16 size = r16();
+				if(!need(size))
+					return truncated();
+				std::cout.write(reinterpret_cast<const char *>(ptr), size);
+				ptr += size;
+				break;
+			}
+
+			default:
+				fprintf(stderr, "Corrupt trace record\n");
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	// Parse options first
@@ -1201,6 +1443,13 @@ int main(int argc, char *argv[])
 	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
 	u32 flags = disasm->interface_flags();
 
+	// Debugger traces carry their own PCs and opcode data
+	if(opts.trace) {
+		int result = disassemble_trace(opts, disasm.get(), (const u8 *)data, length);
+		free(data);
+		return result;
+	}
+
 	// Compute the granularity in bytes (1-8)
 	offs_t granularity = opts.dasm->pcshift < 0 ? disasm->opcode_alignment() << -opts.dasm->pcshift : disasm->opcode_alignment() >> opts.dasm->pcshift;
 